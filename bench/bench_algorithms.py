@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Compile-time cost of the type list algorithms against naive recursive versions.
+
+For each algorithm (type_list_transform, type_list_filter...) and each list
+size, two translation units are generated over a type_list of tag<I> types:
+one applying the algorithm of type_list.hpp and one applying the textbook
+implementation peeling one element per instantiation, as the cons list traits
+of the header do. The lazy views are compared to the eager algorithms
+instead. Both are compiled with -fsyntax-only and a template depth large
+enough for the recursive versions, and the wall time and peak compiler memory
+are reported side by side.
+"""
+
+import argparse
+import csv
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List
+
+from bench_common import markdown_table, measure, write_if_changed
+
+PROLOGUE = """\
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {{}};
+template<typename> struct wrapped {{}};
+template<typename Tp> struct wrap {{ using type = wrapped<Tp>; }};
+
+template<typename> struct is_odd;
+template<std::size_t I> struct is_odd<tag<I>> : bzt::bool_constant<I % 2 == 1> {{}};
+
+template<typename> struct make_list;
+template<std::size_t ... I> struct make_list<std::index_sequence<I...>> {{ using type = bzt::type_list<tag<I>...>; }};
+using list = typename make_list<std::make_index_sequence<{count}>>::type;
+"""
+
+# One instantiation per element, the list being split into its head and the rest.
+NAIVE = """\
+namespace naive {
+    template<typename List, typename Up> struct prepend;
+    template<typename ... Tp, typename Up>
+    struct prepend<bzt::type_list<Tp...>, Up> { using type = bzt::type_list<Up, Tp...>; };
+
+    template<typename List, template<typename> typename F> struct transform { using type = bzt::type_list<>; };
+    template<typename Head, typename ... Tail, template<typename> typename F>
+    struct transform<bzt::type_list<Head, Tail...>, F> :
+            prepend<typename transform<bzt::type_list<Tail...>, F>::type, typename F<Head>::type> {};
+
+    template<typename List, template<typename> typename Pred, bool Keep>
+    struct select { using type = bzt::type_list<>; };
+    template<typename Head, typename ... Tail, template<typename> typename Pred, bool Keep>
+    struct select<bzt::type_list<Head, Tail...>, Pred, Keep> {
+        using rest = typename select<bzt::type_list<Tail...>, Pred, Keep>::type;
+        using type = typename bzt::conditional_t<Pred<Head>::value == Keep,
+                prepend<rest, Head>, bzt::identity<rest>>::type;
+    };
+
+    template<typename List, template<typename> typename Pred>
+    using filter_t = typename select<List, Pred, true>::type;
+    template<typename List, template<typename> typename Pred>
+    using remove_if_t = typename select<List, Pred, false>::type;
+    template<typename List, template<typename> typename Pred>
+    using partition_t = bzt::type_pair<filter_t<List, Pred>, remove_if_t<List, Pred>>;
+
+    template<typename List, template<typename> typename Pred>
+    struct count_if : bzt::integral_constant<std::size_t, 0> {};
+    template<typename Head, typename ... Tail, template<typename> typename Pred>
+    struct count_if<bzt::type_list<Head, Tail...>, Pred> : bzt::integral_constant<std::size_t,
+            Pred<Head>::value + count_if<bzt::type_list<Tail...>, Pred>::value> {};
+
+    template<typename List, template<typename> typename Pred> struct all_of : bzt::true_type {};
+    template<typename Head, typename ... Tail, template<typename> typename Pred>
+    struct all_of<bzt::type_list<Head, Tail...>, Pred> :
+            bzt::bool_constant<Pred<Head>::value && all_of<bzt::type_list<Tail...>, Pred>::value> {};
+
+    template<typename List, template<typename> typename Pred> struct any_of : bzt::false_type {};
+    template<typename Head, typename ... Tail, template<typename> typename Pred>
+    struct any_of<bzt::type_list<Head, Tail...>, Pred> :
+            bzt::bool_constant<Pred<Head>::value || any_of<bzt::type_list<Tail...>, Pred>::value> {};
+
+    template<typename List, template<typename> typename Pred>
+    struct none_of : bzt::bool_constant<!any_of<List, Pred>::value> {};
+}
+"""
+
+
+@dataclass
+class Algorithm:
+    name: str
+    # Line applying the algorithm of each implementation to the list, '{n}' being replaced by its size.
+    bazaar: str
+    naive: str
+
+
+ALGORITHMS: Dict[str, Algorithm] = {algorithm.name: algorithm for algorithm in (
+    Algorithm("transform",
+              "static_assert(bzt::type_list_transform_t<list, wrap>::size() == {n});",
+              "static_assert(naive::transform<list, wrap>::type::size() == {n});"),
+    Algorithm("filter",
+              "static_assert(bzt::type_list_filter_t<list, is_odd>::size() == {n} / 2);",
+              "static_assert(naive::filter_t<list, is_odd>::size() == {n} / 2);"),
+    Algorithm("remove_if",
+              "static_assert(bzt::type_list_remove_if_t<list, is_odd>::size() == ({n} + 1) / 2);",
+              "static_assert(naive::remove_if_t<list, is_odd>::size() == ({n} + 1) / 2);"),
+    Algorithm("partition",
+              "static_assert(bzt::type_list_partition_t<list, is_odd>::second_type::size() == ({n} + 1) / 2);",
+              "static_assert(naive::partition_t<list, is_odd>::second_type::size() == ({n} + 1) / 2);"),
+    Algorithm("count_if",
+              "static_assert(bzt::type_list_count_if_v<list, is_odd> == {n} / 2);",
+              "static_assert(naive::count_if<list, is_odd>::value == {n} / 2);"),
+    Algorithm("all_of",
+              "static_assert(!bzt::type_list_all_of_v<list, is_odd>);",
+              "static_assert(!naive::all_of<list, is_odd>::value);"),
+    Algorithm("any_of",
+              "static_assert(bzt::type_list_any_of_v<list, is_odd>);",
+              "static_assert(naive::any_of<list, is_odd>::value);"),
+    Algorithm("none_of",
+              "static_assert(!bzt::type_list_none_of_v<list, is_odd>);",
+              "static_assert(!naive::none_of<list, is_odd>::value);"),
+    # The views are compared to picking the same element of the list built by the eager algorithm.
+    Algorithm("transform_view_at",
+              "static_assert(bzt::is_same_v<bzt::type_list_at_t<bzt::type_list_transform_view<list, wrap>, {n} / 2>,"
+              " wrapped<tag<{n} / 2>>>);",
+              "static_assert(bzt::is_same_v<bzt::type_list_at_t<bzt::type_list_transform_t<list, wrap>, {n} / 2>,"
+              " wrapped<tag<{n} / 2>>>);"),
+    Algorithm("filter_view_front",
+              "static_assert(bzt::is_same_v<bzt::type_list_front_t<bzt::type_list_filter_view<list, is_odd>>,"
+              " tag<1>>);",
+              "static_assert(bzt::is_same_v<bzt::type_list_front_t<bzt::type_list_filter_t<list, is_odd>>, tag<1>>);"),
+)}
+
+DEFAULT_SIZES = (100, 1000, 10000)
+
+
+def generate(algorithm: Algorithm, implementation: str, count: int) -> str:
+    naive = NAIVE if implementation == "naive" else ""
+    line = getattr(algorithm, implementation).format(n=count)
+    return f"{PROLOGUE.format(count=count)}\n{naive}\n{line}\n"
+
+
+def run(args: argparse.Namespace) -> List[List[object]]:
+    names = args.algorithms or list(ALGORITHMS)
+    unknown = [name for name in names if name not in ALGORITHMS]
+    if unknown:
+        sys.exit(f"unknown algorithms: {', '.join(unknown)} (available: {', '.join(ALGORITHMS)})")
+
+    include_dirs = [Path(args.include)]
+    rows = []
+    for name in names:
+        for count in args.size or DEFAULT_SIZES:
+            # The naive versions need one level of template depth per element.
+            flags = ["-std=c++17", "-fsyntax-only", f"-ftemplate-depth={count + 1024}", *args.flag]
+            results = {}
+            for implementation in ("bazaar", "naive"):
+                content = generate(ALGORITHMS[name], implementation, count)
+                source = write_if_changed(Path(args.work_dir) / f"{name}_{count}_{implementation}.cc", content)
+                result = measure(args.compiler, source, include_dirs, flags, args.repeat, args.timeout)
+                if not result.ok:
+                    print(f"[{name} {count}] {implementation} failed to compile:\n{result.stderr}", file=sys.stderr)
+                results[implementation] = result
+            bazaar, naive = results["bazaar"], results["naive"]
+            row = [name, count,
+                   f"{bazaar.wall_ms:.0f}" if bazaar.ok else "error", f"{naive.wall_ms:.0f}" if naive.ok else "error",
+                   f"{bazaar.wall_ms / naive.wall_ms:.2f}" if bazaar.ok and naive.ok else "-",
+                   bazaar.peak_rss_kb // 1024, naive.peak_rss_kb // 1024]
+            rows.append(row)
+            print(" ".join(str(cell) for cell in row), file=sys.stderr, flush=True)
+    return rows
+
+
+HEADER = ["algorithm", "N", "bazaar ms", "naive ms", "bazaar/naive", "bazaar MiB", "naive MiB"]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="c++", help="C++ compiler to benchmark")
+    parser.add_argument("--include", default=str(Path(__file__).resolve().parent.parent / "include"),
+                        help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="bench_algorithms", help="where generated translation units are written")
+    parser.add_argument("--size", type=int, action="append",
+                        help=f"list size, may be repeated (default: {', '.join(map(str, DEFAULT_SIZES))})")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per TU, the fastest one is kept")
+    parser.add_argument("--timeout", type=float, default=600, help="seconds after which a compilation is abandoned")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, may be repeated")
+    parser.add_argument("--csv", help="also write the results to this CSV file")
+    parser.add_argument("algorithms", nargs="*", help="algorithms to run (default: all)")
+    args = parser.parse_args()
+
+    rows = run(args)
+    print(markdown_table(HEADER, rows))
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(HEADER)
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
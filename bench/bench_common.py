@@ -0,0 +1,103 @@
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Shared helpers of the compile-time benchmark tools.
+
+A benchmark is always the same experiment: write a translation unit, run the
+compiler on it and record how long it took and how much memory the compiler
+process used at its peak.
+"""
+
+import os
+import statistics
+import subprocess
+import tempfile
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import List, Optional, Sequence
+
+DEFAULT_FLAGS = ("-std=c++17", "-fsyntax-only")
+
+
+@dataclass
+class CompileResult:
+    ok: bool
+    wall_ms: float
+    peak_rss_kb: int
+    stderr: str
+
+
+def compile_tu(compiler: str, source: Path, include_dirs: Sequence[Path] = (),
+               flags: Sequence[str] = DEFAULT_FLAGS, timeout: Optional[float] = None) -> CompileResult:
+    """Compile one translation unit and measure it.
+
+    The peak resident set size is the one reported by wait4(2) for the compiler
+    driver, which accounts for the children it waited for (cc1plus, clang -cc1).
+    """
+    command: List[str] = [compiler, *flags]
+    command += [f"-I{directory}" for directory in include_dirs]
+    command.append(str(source))
+    with tempfile.TemporaryFile() as stderr:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=stderr)
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            if timeout is not None and time.perf_counter() - start > timeout:
+                process.kill()
+                pid, status, usage = os.wait4(process.pid, 0)
+                process.returncode = -1
+                return CompileResult(False, (time.perf_counter() - start) * 1000.0, usage.ru_maxrss, "timeout")
+            time.sleep(0.002)
+        wall_ms = (time.perf_counter() - start) * 1000.0
+        process.returncode = os.waitstatus_to_exitcode(status)
+        stderr.seek(0)
+        message = stderr.read().decode(errors="replace")
+    return CompileResult(process.returncode == 0, wall_ms, usage.ru_maxrss, message)
+
+
+def measure(compiler: str, source: Path, include_dirs: Sequence[Path] = (),
+            flags: Sequence[str] = DEFAULT_FLAGS, repeat: int = 1,
+            timeout: Optional[float] = None) -> CompileResult:
+    """Compile a translation unit `repeat` times, keep the fastest wall time."""
+    best: Optional[CompileResult] = None
+    for _ in range(max(1, repeat)):
+        result = compile_tu(compiler, source, include_dirs, flags, timeout)
+        if not result.ok:
+            return result
+        if best is None or result.wall_ms < best.wall_ms:
+            best = result
+    return best
+
+
+def measure_median(compiler: str, source: Path, include_dirs: Sequence[Path] = (),
+                   flags: Sequence[str] = DEFAULT_FLAGS, repeat: int = 1,
+                   timeout: Optional[float] = None) -> CompileResult:
+    """Compile a translation unit `repeat` times, keep the median wall time and the highest peak memory."""
+    results: List[CompileResult] = []
+    for _ in range(max(1, repeat)):
+        result = compile_tu(compiler, source, include_dirs, flags, timeout)
+        if not result.ok:
+            return result
+        results.append(result)
+    wall_ms = statistics.median(result.wall_ms for result in results)
+    return CompileResult(True, wall_ms, max(result.peak_rss_kb for result in results), results[-1].stderr)
+
+
+def write_if_changed(path: Path, content: str) -> Path:
+    path.parent.mkdir(parents=True, exist_ok=True)
+    if not path.exists() or path.read_text() != content:
+        path.write_text(content)
+    return path
+
+
+def markdown_table(header: Sequence[str], rows: Sequence[Sequence[object]]) -> str:
+    lines = ["| " + " | ".join(header) + " |",
+             "|" + "|".join("---" for _ in header) + "|"]
+    lines += ["| " + " | ".join(str(cell) for cell in row) + " |" for row in rows]
+    return os.linesep.join(lines)
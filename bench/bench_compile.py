@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Compile-time cost of every trait family, bazaar against the standard library.
+
+For each family, two translation units are generated: one instantiating the
+bazaar trait over N distinct synthetic types, and the same one written against
+<type_traits>/<utility>/<ratio>. Both are compiled with -fsyntax-only and the
+wall time and peak compiler memory are reported side by side.
+
+With --builtins, the traits implemented with a compiler intrinsic when it is
+available (is_class, is_empty, is_base_of...) are compared against their
+handwritten fallbacks instead, the second translation unit defining
+BAZAAR_TRAITS_NO_COMPILER_SUPPORT.
+"""
+
+import argparse
+import csv
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Callable, Dict, List, Sequence
+
+from bench_common import markdown_table, measure, write_if_changed
+
+BAZAAR = {
+    "name": "bazaar",
+    "includes": ("<utility>", '"bazaar_traits.hpp"', '"integer_sequence.hpp"', '"ratio.hpp"'),
+    "tr": "bazaar::traits",
+    "ra": "bazaar",
+}
+
+FALLBACK = {**BAZAAR, "name": "fallback", "defines": ("BAZAAR_TRAITS_NO_COMPILER_SUPPORT",)}
+
+STANDARD = {
+    "name": "std",
+    "includes": ("<utility>", "<type_traits>", "<ratio>"),
+    "tr": "std",
+    "ra": "std",
+}
+
+
+@dataclass
+class Family:
+    name: str
+    # Returns the line instantiating the trait for the i-th synthetic type.
+    # '{tr}' is replaced by the traits namespace and '{ra}' by the ratio one.
+    instantiate: Callable[[int], str]
+    default_count: int = 2000
+
+
+def _value(expression: str) -> Callable[[int], str]:
+    return lambda i: f"static_assert({expression.format(i=i, j=i + 1, k=i + 2, tr='{tr}', ra='{ra}')} || true);"
+
+
+def _type(expression: str) -> Callable[[int], str]:
+    return lambda i: f"using alias_{i} = {expression.format(i=i, j=i + 1, k=i + 2, tr='{tr}', ra='{ra}')};"
+
+
+FAMILIES: Dict[str, Family] = {family.name: family for family in (
+    Family("rank", _value("{tr}::rank<S{i}[1][2][3]>::value")),
+    Family("extent", _value("{tr}::extent<S{i}[1][2][3], 2>::value")),
+    Family("is_same", _value("{tr}::is_same<S{i}, S{j}>::value")),
+    Family("is_void", _value("{tr}::is_void<S{i}>::value")),
+    Family("is_integral", _value("{tr}::is_integral<S{i}>::value")),
+    Family("is_class", _value("{tr}::is_class<S{i}>::value")),
+    Family("is_enum", _value("{tr}::is_enum<E{i}>::value")),
+    Family("is_union", _value("{tr}::is_union<S{i}>::value")),
+    Family("is_function", _value("{tr}::is_function<S{i}>::value")),
+    Family("is_constructible", _value("{tr}::is_constructible<S{i}, int>::value")),
+    Family("is_nothrow_constructible", _value("{tr}::is_nothrow_constructible<S{i}, int>::value")),
+    Family("is_copy_assignable", _value("{tr}::is_copy_assignable<S{i}>::value")),
+    Family("is_destructible", _value("{tr}::is_destructible<S{i}>::value")),
+    Family("is_swappable", _value("{tr}::is_swappable<S{i}>::value")),
+    Family("is_nothrow_swappable", _value("{tr}::is_nothrow_swappable<S{i}>::value")),
+    Family("is_trivially_copyable", _value("{tr}::is_trivially_copyable<S{i}>::value")),
+    Family("is_trivial", _value("{tr}::is_trivial<S{i}>::value")),
+    Family("is_standard_layout", _value("{tr}::is_standard_layout<S{i}>::value")),
+    Family("is_empty", _value("{tr}::is_empty<S{i}>::value")),
+    Family("is_polymorphic", _value("{tr}::is_polymorphic<S{i}>::value")),
+    Family("is_base_of", _value("{tr}::is_base_of<S{i}, S{j}>::value")),
+    Family("is_convertible", _value("{tr}::is_convertible<S{i}, S{j}>::value")),
+    Family("conjunction", _value("{tr}::conjunction<{tr}::is_class<S{i}>, {tr}::is_class<S{j}>>::value")),
+    Family("decay", _type("typename {tr}::decay<const S{i}&>::type")),
+    Family("make_signed", _type("typename {tr}::make_signed<E{i}>::type")),
+    Family("underlying_type", _type("typename {tr}::underlying_type<E{i}>::type")),
+    Family("common_type", _type("typename {tr}::common_type<S{i}, const S{i}&, S{i}&&>::type")),
+    Family("make_index_sequence", _type("{tr}::make_index_sequence<{i}>"), 1000),
+    Family("make_integer_sequence", _type("{tr}::make_integer_sequence<int, {i}>"), 1000),
+    Family("ratio_add", _type("{ra}::ratio_add<{ra}::ratio<{i}, {j}>, {ra}::ratio<1, {j}>>")),
+    Family("ratio_less", _value("{ra}::ratio_less<{ra}::ratio<{j}, {k}>, {ra}::ratio<{k}, {j}>>::value")),
+)}
+
+# Families having both an intrinsic and a handwritten implementation, see USE_COMPILER_SUPPORT_WHEN_POSSIBLE.
+BUILTIN_FAMILIES = ("is_class", "is_enum", "is_trivially_copyable", "is_trivial", "is_standard_layout", "is_empty",
+                    "is_polymorphic", "is_base_of", "is_nothrow_constructible", "make_index_sequence",
+                    "make_integer_sequence")
+
+
+def synthetic_types(count: int) -> str:
+    # One more type than requested because binary families pair S{i} with S{i+1}.
+    lines = []
+    for i in range(count + 1):
+        lines.append(f"struct S{i} {{ int value; S{i}() = default; S{i}(int v) : value(v) {{}} }};")
+        lines.append(f"enum class E{i} : {('unsigned char', 'short', 'int', 'long')[i % 4]} {{}};")
+    return "\n".join(lines)
+
+
+def prologue(library: dict) -> str:
+    defines = [f"#define {define}" for define in library.get("defines", ())]
+    return "\n".join([*defines, *(f"#include {header}" for header in library["includes"])])
+
+
+def generate(family: Family, library: dict, count: int) -> str:
+    includes = prologue(library)
+    body = "\n".join(family.instantiate(i).format(tr=library["tr"], ra=library["ra"]) for i in range(count))
+    return f"{includes}\n\n{synthetic_types(count)}\n\n{body}\n"
+
+
+def baseline(library: dict, count: int) -> str:
+    includes = prologue(library)
+    return f"{includes}\n\n{synthetic_types(count)}\n"
+
+
+def run(args: argparse.Namespace) -> List[List[object]]:
+    available = BUILTIN_FAMILIES if args.builtins else list(FAMILIES)
+    names: Sequence[str] = args.families or available
+    unknown = [name for name in names if name not in available]
+    if unknown:
+        sys.exit(f"unknown families: {', '.join(unknown)} (available: {', '.join(available)})")
+
+    include_dirs = [Path(args.include)]
+    flags = ["-std=c++17", "-fsyntax-only", *args.flag]
+    rows = []
+    for name in ["<baseline>", *names]:
+        family = FAMILIES.get(name)
+        count = args.count or (family.default_count if family else 2000)
+        results = {}
+        for library in libraries(args):
+            content = generate(family, library, count) if family else baseline(library, count)
+            source = write_if_changed(Path(args.work_dir) / f"{name.strip('<>')}_{library['name']}.cc", content)
+            result = measure(args.compiler, source, include_dirs, flags, args.repeat)
+            if not result.ok:
+                print(f"[{name}] {library['name']} failed to compile:\n{result.stderr}", file=sys.stderr)
+            results[library["name"]] = result
+        first, second = (results[library["name"]] for library in libraries(args))
+        row = [name, count,
+               f"{first.wall_ms:.0f}" if first.ok else "error", f"{second.wall_ms:.0f}" if second.ok else "error",
+               f"{first.wall_ms / second.wall_ms:.2f}" if first.ok and second.ok else "-",
+               first.peak_rss_kb // 1024, second.peak_rss_kb // 1024]
+        rows.append(row)
+        print(" ".join(str(cell) for cell in row), file=sys.stderr, flush=True)
+    return rows
+
+
+def libraries(args: argparse.Namespace):
+    return (BAZAAR, FALLBACK) if args.builtins else (BAZAAR, STANDARD)
+
+
+def header(args: argparse.Namespace) -> List[str]:
+    first, second = (library["name"] for library in libraries(args))
+    return ["family", "N", f"{first} ms", f"{second} ms", f"{first}/{second}", f"{first} MiB", f"{second} MiB"]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="c++", help="C++ compiler to benchmark")
+    parser.add_argument("--include", default=str(Path(__file__).resolve().parent.parent / "include"),
+                        help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="bench_compile", help="where generated translation units are written")
+    parser.add_argument("--count", type=int, default=0, help="override the number of types of every family")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per TU, the fastest one is kept")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, may be repeated")
+    parser.add_argument("--builtins", action="store_true",
+                        help="compare the intrinsic based traits against their handwritten fallbacks")
+    parser.add_argument("--csv", help="also write the results to this CSV file")
+    parser.add_argument("families", nargs="*", help="families to run (default: all)")
+    args = parser.parse_args()
+
+    rows = run(args)
+    print(markdown_table(header(args), rows))
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(header(args))
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Compile-time cost of make_index_sequence and make_integer_sequence by length.
+
+For each length, the same translation unit making one index sequence and one
+int sequence of that length is compiled three times: with bazaar_traits using
+the builtin of the compiler (__integer_pack for GCC, __make_integer_seq for
+Clang), with its portable template generator (BAZAAR_TRAITS_NO_COMPILER_SUPPORT)
+and with <utility>. The wall time and peak compiler memory are reported side by
+side.
+"""
+
+import argparse
+import csv
+import sys
+from pathlib import Path
+from typing import List
+
+from bench_common import markdown_table, measure, write_if_changed
+
+LIBRARIES = (
+    ("builtin", '#include <utility>\n#include "integer_sequence.hpp"\nnamespace seq = bazaar::traits;\n'),
+    ("fallback", '#define BAZAAR_TRAITS_NO_COMPILER_SUPPORT\n'
+                 '#include <utility>\n#include "integer_sequence.hpp"\nnamespace seq = bazaar::traits;\n'),
+    ("std", "#include <utility>\nnamespace seq = std;\n"),
+)
+
+BODY = """
+static_assert(seq::make_index_sequence<{n}>::size() == {n});
+static_assert(seq::make_integer_sequence<int, {n}>::size() == {n});
+"""
+
+DEFAULT_SIZES = (1000, 10000, 100000)
+
+
+def run(args: argparse.Namespace) -> List[List[object]]:
+    include_dirs = [Path(args.include)]
+    flags = ["-std=c++17", "-fsyntax-only", *args.flag]
+    rows = []
+    for count in args.size or DEFAULT_SIZES:
+        results = []
+        for name, prologue in LIBRARIES:
+            source = write_if_changed(Path(args.work_dir) / f"sequence_{count}_{name}.cc",
+                                      prologue + BODY.format(n=count))
+            result = measure(args.compiler, source, include_dirs, flags, args.repeat, args.timeout)
+            if not result.ok:
+                print(f"[{count}] {name} failed to compile:\n{result.stderr}", file=sys.stderr)
+            results.append(result)
+        row = [count,
+               *(f"{result.wall_ms:.0f}" if result.ok else "error" for result in results),
+               *(result.peak_rss_kb // 1024 for result in results)]
+        rows.append(row)
+        print(" ".join(str(cell) for cell in row), file=sys.stderr, flush=True)
+    return rows
+
+
+HEADER = ["N", *(f"{name} ms" for name, _ in LIBRARIES), *(f"{name} MiB" for name, _ in LIBRARIES)]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="c++", help="C++ compiler to benchmark")
+    parser.add_argument("--include", default=str(Path(__file__).resolve().parent.parent / "include"),
+                        help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="bench_sequences", help="where generated translation units are written")
+    parser.add_argument("--size", type=int, action="append",
+                        help=f"sequence length, may be repeated (default: {', '.join(map(str, DEFAULT_SIZES))})")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per TU, the fastest one is kept")
+    parser.add_argument("--timeout", type=float, default=600, help="seconds after which a compilation is abandoned")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, may be repeated")
+    parser.add_argument("--csv", help="also write the results to this CSV file")
+    args = parser.parse_args()
+
+    rows = run(args)
+    print(markdown_table(HEADER, rows))
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(HEADER)
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Fails when a stress translation unit exceeds its compile time or memory budget.
+
+The budgets are checked in compile_budgets.json, one entry per stress TU
+under "budgets", a "note" telling why an entry needs its flags:
+
+    "name": {"source": "stress/name.cc", "flags": [...], "max_ms": 1000, "max_rss_mb": 128}
+
+The time budgets are about twice the median measured on the machine and with
+the compiler recorded in "measured_on", the memory budgets 1.5 times the peak,
+and the check compares the median of --repeat compilations to them. Wall times depend on the machine running the
+check, --time-scale (or the BAZAAR_TRAITS_BUDGET_TIME_SCALE environment
+variable) multiplies every time budget for slower hosts. Memory budgets are
+not scaled.
+"""
+
+import argparse
+import json
+import os
+import sys
+from pathlib import Path
+
+from bench_common import DEFAULT_FLAGS, measure_median
+
+BENCH_DIR = Path(__file__).resolve().parent
+
+
+def check(name: str, budget: dict, compiler: str, include_dirs, time_scale: float, repeat: int) -> bool:
+    source = BENCH_DIR / budget["source"]
+    result = measure_median(compiler, source, include_dirs, [*DEFAULT_FLAGS, *budget.get("flags", [])], repeat)
+    if not result.ok:
+        print(f"{name}: {source.name} failed to compile\n{result.stderr}")
+        return False
+    max_ms = budget["max_ms"] * time_scale
+    rss_mb = result.peak_rss_kb / 1024
+    within_time = result.wall_ms <= max_ms
+    within_memory = rss_mb <= budget["max_rss_mb"]
+    print(f"{name}: {result.wall_ms:.0f} ms (budget {max_ms:.0f} ms){'' if within_time else ' EXCEEDED'}, "
+          f"{rss_mb:.0f} MiB (budget {budget['max_rss_mb']} MiB){'' if within_memory else ' EXCEEDED'}")
+    return within_time and within_memory
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="c++", help="C++ compiler to check")
+    parser.add_argument("--include", default=str(BENCH_DIR.parent / "include"), help="bazaar_traits include directory")
+    parser.add_argument("--budgets", default=str(BENCH_DIR / "compile_budgets.json"), help="budgets file")
+    parser.add_argument("--time-scale", type=float,
+                        default=float(os.environ.get("BAZAAR_TRAITS_BUDGET_TIME_SCALE", "1")),
+                        help="multiplier applied to every time budget")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per TU, their median is checked")
+    parser.add_argument("names", nargs="*", help="stress TUs to check (default: all)")
+    args = parser.parse_args()
+
+    budgets = json.loads(Path(args.budgets).read_text())["budgets"]
+    names = args.names or list(budgets)
+    unknown = [name for name in names if name not in budgets]
+    if unknown:
+        sys.exit(f"no budget for: {', '.join(unknown)}")
+    results = [check(name, budgets[name], args.compiler, [Path(args.include)], args.time_scale, args.repeat)
+               for name in names]
+    sys.exit(0 if all(results) else 1)
+
+
+if __name__ == "__main__":
+    main()
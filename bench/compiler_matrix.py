@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Compile time and peak memory of every trait family under every installed compiler.
+
+The header takes different paths per compiler (__make_integer_seq on Clang,
+the intrinsics enabled by IS_COMPILER_GCC...), so the translation units of
+bench_compile.py are compiled with each GCC and Clang found on the PATH
+(g++, g++-12, clang++-15...) or given with --compiler. The result is a single
+matrix, one row per family and two columns (ms, MiB) per compiler.
+"""
+
+import argparse
+import csv
+import os
+import re
+import subprocess
+import sys
+from pathlib import Path
+from typing import List, Sequence
+
+from bench_common import markdown_table, measure, write_if_changed
+from bench_compile import BAZAAR, FAMILIES, baseline, generate
+
+COMPILER_NAME = re.compile(r"^(g\+\+|clang\+\+)(-\d+(\.\d+)*)?$")
+
+
+def installed_compilers() -> List[str]:
+    """GCC and Clang drivers of the PATH, one per executable they resolve to."""
+    found, seen = [], set()
+    for directory in os.environ.get("PATH", "").split(os.pathsep):
+        if not os.path.isdir(directory):
+            continue
+        for name in sorted(os.listdir(directory)):
+            path = os.path.join(directory, name)
+            if not COMPILER_NAME.match(name) or not os.access(path, os.X_OK):
+                continue
+            real = os.path.realpath(path)
+            if real not in seen:
+                seen.add(real)
+                found.append(name)
+    return found
+
+
+def version(compiler: str) -> str:
+    # Clang does not know -dumpfullversion, GCC truncates -dumpversion to the major version.
+    for option in ("-dumpfullversion", "-dumpversion"):
+        process = subprocess.run([compiler, option], capture_output=True, text=True)
+        if process.returncode == 0 and process.stdout.strip():
+            return process.stdout.strip()
+    return "?"
+
+
+def run(args: argparse.Namespace, compilers: Sequence[str]) -> List[List[object]]:
+    names = args.families or list(FAMILIES)
+    unknown = [name for name in names if name not in FAMILIES]
+    if unknown:
+        sys.exit(f"unknown families: {', '.join(unknown)} (available: {', '.join(FAMILIES)})")
+
+    include_dirs = [Path(args.include)]
+    flags = ["-std=c++17", "-fsyntax-only", *args.flag]
+    rows = []
+    for name in ["<baseline>", *names]:
+        family = FAMILIES.get(name)
+        count = args.count or (family.default_count if family else 2000)
+        content = generate(family, BAZAAR, count) if family else baseline(BAZAAR, count)
+        source = write_if_changed(Path(args.work_dir) / f"{name.strip('<>')}.cc", content)
+        row: List[object] = [name, count]
+        for compiler in compilers:
+            result = measure(compiler, source, include_dirs, flags, args.repeat)
+            if not result.ok:
+                print(f"[{name}] {compiler} failed to compile:\n{result.stderr}", file=sys.stderr)
+            row += [f"{result.wall_ms:.0f}" if result.ok else "error", result.peak_rss_kb // 1024]
+        rows.append(row)
+        print(" ".join(str(cell) for cell in row), file=sys.stderr, flush=True)
+    return rows
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", action="append", help="compiler to run, may be repeated (default: all found)")
+    parser.add_argument("--include", default=str(Path(__file__).resolve().parent.parent / "include"),
+                        help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="compiler_matrix", help="where generated translation units are written")
+    parser.add_argument("--count", type=int, default=0, help="override the number of types of every family")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per TU, the fastest one is kept")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, may be repeated")
+    parser.add_argument("--csv", help="also write the matrix to this CSV file")
+    parser.add_argument("families", nargs="*", help="families to run (default: all)")
+    args = parser.parse_args()
+
+    compilers = args.compiler or installed_compilers()
+    if not compilers:
+        sys.exit("no g++ or clang++ found on the PATH, give them with --compiler")
+    labels = [f"{Path(compiler).name} {version(compiler)}" for compiler in compilers]
+    print(f"compilers: {', '.join(labels)}", file=sys.stderr)
+
+    rows = run(args, compilers)
+    header = ["family", "N"] + [f"{label} {unit}" for label in labels for unit in ("ms", "MiB")]
+    print(markdown_table(header, rows))
+    if args.csv:
+        with open(args.csv, "w", newline="") as output:
+            writer = csv.writer(output)
+            writer.writerow(header)
+            writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Largest pack size each recursive trait supports under the default template depth.
+
+Several implementations recurse once per element of their pack. For each of
+them, a translation unit instantiating the trait over N elements is compiled
+without -ftemplate-depth, N is doubled until the compilation fails and then
+bisected. The largest N that compiles is reported with its compile time, so
+the scaling ceiling of each trait is known before generated code hits it.
+The packs are built with std::make_index_sequence so that only the probed
+template contributes to the depth.
+"""
+
+import argparse
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Callable, List, Optional, Tuple
+
+from bench_common import CompileResult, DEFAULT_FLAGS, markdown_table, measure, write_if_changed
+
+PRELUDE = """#include <utility>
+#include "bazaar_traits.hpp"
+#include "arithmetic.hpp"
+#include "ratio.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t> struct tag {};
+template<typename> struct probe;
+"""
+
+DEPTH_ERRORS = ("template instantiation depth exceeds",  # GCC
+                "recursive template instantiation exceeded maximum depth",  # Clang
+                "exceeded maximum depth")
+
+
+@dataclass
+class Probe:
+    name: str
+    template: str
+    # C++ code instantiating the probed template over n elements, appended to PRELUDE.
+    code: Callable[[int], str]
+    # Largest n the probe can express at all, regardless of the template depth.
+    domain: int = 1 << 16
+    domain_reason: str = "search cap"
+
+
+def _pack_probe(base: str, check: str) -> Callable[[int], str]:
+    return lambda n: (f"template<std::size_t ... I>\n"
+                      f"struct probe<std::index_sequence<I...>> : public {base} {{}};\n"
+                      f"using tested = probe<std::make_index_sequence<{n}>>;\n"
+                      f"static_assert({check.format(n=n, last=n - 1)});\n")
+
+
+def _fibonacci(count: int) -> List[int]:
+    numbers = [1, 1]
+    while len(numbers) < count:
+        numbers.append(numbers[-1] + numbers[-2])
+    return numbers
+
+
+def _ratio_probe(n: int) -> str:
+    # Consecutive Fibonacci ratios have the longest identical continued fraction
+    # expansions, ratio_less_base recurses once per shared term.
+    fibonacci = _fibonacci(n + 3)
+    return (f"using tested = bazaar::ratio_less<bazaar::ratio<{fibonacci[n + 1]}, {fibonacci[n]}>,\n"
+            f"        bazaar::ratio<{fibonacci[n + 2]}, {fibonacci[n + 1]}>>;\n"
+            f"static_assert(tested::value || !tested::value);\n")
+
+
+def _cons_list_probe(n: int) -> str:
+    # The cons list is built by a fold so that its construction does not recurse.
+    # Only its innermost element, the last one walked, is large enough.
+    return ("template<typename List> struct builder { using type = List; };\n"
+            "template<typename List, typename Tp>\n"
+            "builder<bzt::type_list_t<Tp, List>> operator+(builder<List>, bzt::identity<Tp>);\n"
+            "template<std::size_t ... I>\n"
+            "struct probe<std::index_sequence<I...>> : public decltype((builder<bzt::impl::end_of_list>{} + ...\n"
+            "        + bzt::identity<bzt::conditional_t<I == 0, char[2], char>>{})) {};\n"
+            f"using tested = bzt::impl::find_first_upper_bound_element_by_size<\n"
+            f"        probe<std::make_index_sequence<{n}>>::type, 2>;\n"
+            "static_assert(bzt::is_same_v<tested::type, char[2]>);\n")
+
+
+PROBES = [
+    Probe("conjunction", "impl::conjunction_impl",
+          _pack_probe("bzt::conjunction<bzt::is_class<tag<I>>...>", "tested::value")),
+    Probe("disjunction", "impl::disjunction_impl",
+          _pack_probe("bzt::disjunction<bzt::is_union<tag<I>>...>", "!tested::value")),
+    Probe("static_max", "impl::static_max_impl",
+          _pack_probe("bzt::static_max<I...>", "tested::value == {last}")),
+    Probe("static_min", "impl::static_min_impl",
+          _pack_probe("bzt::static_min<I...>", "tested::value == 0")),
+    Probe("common_type", "impl::common_type_sequence_impl",
+          _pack_probe("bzt::common_type<bzt::conditional_t<I % 2 == 0, int, short>...>",
+                      "bzt::is_same_v<tested::type, int>")),
+    Probe("find_first_upper_bound_element_by_size", "impl::find_first_upper_bound_element_by_size",
+          _cons_list_probe),
+    Probe("ratio_less", "impl::ratio_less_base", _ratio_probe, domain=88, domain_reason="std::intmax_t range"),
+]
+
+
+def _try(compiler: str, probe: Probe, n: int, args: argparse.Namespace) -> Tuple[bool, CompileResult]:
+    source = write_if_changed(Path(args.work_dir) / f"{probe.name}.cc", PRELUDE + "\n" + probe.code(n))
+    result = measure(compiler, source, [Path(args.include)], [*DEFAULT_FLAGS, *args.flag], timeout=args.timeout)
+    if not result.ok and result.stderr != "timeout" and not any(error in result.stderr for error in DEPTH_ERRORS):
+        sys.exit(f"{probe.name} failed for another reason than the template depth at N={n}:\n{result.stderr}")
+    return result.ok, result
+
+
+def search(compiler: str, probe: Probe, args: argparse.Namespace) -> List[object]:
+    """Exponential then binary search of the largest N that compiles."""
+    limit = min(probe.domain, args.max)
+    best: Optional[CompileResult] = None
+    low, high, reason = 0, None, probe.domain_reason if probe.domain <= args.max else "search cap"
+    n = min(args.start, limit)
+    while high is None:
+        ok, result = _try(compiler, probe, n, args)
+        if ok:
+            low, best = n, result
+            if n == limit:
+                break
+            n = min(n * 2, limit)
+        else:
+            high = n
+            reason = "timeout" if result.stderr == "timeout" else "template depth"
+    while high is not None and high - low > 1:
+        n = (low + high) // 2
+        ok, result = _try(compiler, probe, n, args)
+        if ok:
+            low, best = n, result
+        else:
+            high = n
+    if best is None:
+        return [probe.name, f"`{probe.template}`", "< " + str(args.start), "-", "-", reason]
+    return [probe.name, f"`{probe.template}`", low, f"{best.wall_ms:.0f}", best.peak_rss_kb // 1024, reason]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", action="append", help="compiler to probe, may be repeated (default: c++)")
+    parser.add_argument("--include", default=str(Path(__file__).resolve().parent.parent / "include"),
+                        help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="depth_probe", help="where generated translation units are written")
+    parser.add_argument("--start", type=int, default=64, help="first N tried")
+    parser.add_argument("--max", type=int, default=1 << 16, help="largest N tried")
+    parser.add_argument("--timeout", type=float, default=120, help="seconds after which a compilation counts as failed")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, may be repeated")
+    parser.add_argument("probes", nargs="*", help="probes to run (default: all)")
+    args = parser.parse_args()
+
+    probes = [probe for probe in PROBES if not args.probes or probe.name in args.probes]
+    for compiler in args.compiler or ["c++"]:
+        rows = []
+        for probe in probes:
+            rows.append(search(compiler, probe, args))
+            print(" ".join(str(cell) for cell in rows[-1]), file=sys.stderr, flush=True)
+        print(f"\n### {compiler}\n")
+        print(markdown_table(["probe", "template", "max N", "ms at max N", "MiB at max N", "limited by"], rows))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,41 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: common_type over 256 types.
+
+#include <utility>
+#include "bazaar_traits.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct arithmetic;
+template<> struct arithmetic<0> : public bzt::identity<char> {};
+template<> struct arithmetic<1> : public bzt::identity<const short&> {};
+template<> struct arithmetic<2> : public bzt::identity<unsigned char> {};
+template<> struct arithmetic<3> : public bzt::identity<int&&> {};
+template<> struct arithmetic<4> : public bzt::identity<volatile long> {};
+template<> struct arithmetic<5> : public bzt::identity<float> {};
+template<> struct arithmetic<6> : public bzt::identity<const long long> {};
+template<> struct arithmetic<7> : public bzt::identity<double&> {};
+
+template<typename> struct common_arithmetic;
+template<std::size_t ... I>
+struct common_arithmetic<std::index_sequence<I...>> : public bzt::common_type<typename arithmetic<I % 8>::type...> {};
+
+static_assert(bzt::is_same_v<common_arithmetic<std::make_index_sequence<256>>::type, double>);
@@ -0,0 +1,38 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: conjunction and disjunction over 2000 traits.
+
+#include <utility>
+#include "bazaar_traits.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+template<typename> struct conjunction_of_tags;
+template<std::size_t ... I>
+struct conjunction_of_tags<std::index_sequence<I...>> : public bzt::conjunction<bzt::is_class<tag<I>>...> {};
+
+template<typename> struct disjunction_of_tags;
+template<std::size_t ... I>
+struct disjunction_of_tags<std::index_sequence<I...>> : public bzt::disjunction<bzt::is_union<tag<I>>...> {};
+
+static_assert(conjunction_of_tags<std::make_index_sequence<2000>>::value);
+static_assert(!disjunction_of_tags<std::make_index_sequence<2000>>::value);
@@ -0,0 +1,40 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: integer sequence algorithms over 5000 elements, at the default template depth.
+// GCC reads each element back from an array held by a class specialized over the whole pack, so the
+// cost of every reordering trait grows with the square of the length; 5000 keeps this TU around 3 s.
+
+#include <utility>
+#include "integer_sequence.hpp"
+
+namespace bzt = bazaar::traits;
+
+using sequence = bzt::make_index_sequence<5000>;
+using reversed = bzt::integer_sequence_reverse_t<sequence>;
+using offsets = bzt::integer_sequence_exclusive_scan_t<sequence>;
+
+static_assert(bzt::integer_sequence_concat_t<sequence, reversed>::size() == 10000);
+static_assert(bzt::integer_sequence_at_v<reversed, 0> == 4999);
+static_assert(bzt::integer_sequence_at_v<offsets, 4999> == 4999 * 4998 / 2);
+static_assert(bzt::integer_sequence_at_v<bzt::integer_sequence_inclusive_scan_t<sequence>, 4999> == 4999 * 5000 / 2);
+static_assert(bzt::integer_sequence_sum_v<sequence> == 4999 * 5000 / 2);
+static_assert(bzt::integer_sequence_product_v<bzt::integer_sequence_select_t<sequence, bzt::make_index_range<1, 5000,
+        2500>>> == 2501);
+static_assert(bzt::is_same_v<bzt::integer_sequence_select_t<sequence, reversed>, reversed>);
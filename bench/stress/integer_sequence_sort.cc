@@ -0,0 +1,42 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: sort, argsort, inverse permutation and unique of 4096 values, at the default template depth
+// and constexpr limits. Each sort takes about 200000 constexpr steps with Clang, under its default -fconstexpr-steps
+// of 1048576 (see the sort section of integer_sequence.hpp).
+
+#include <utility>
+#include "integer_sequence.hpp"
+
+namespace bzt = bazaar::traits;
+
+// An odd multiplier modulo a power of two permutes the indexes
+template<std::size_t ... Indexes>
+bzt::integer_sequence<std::size_t, Indexes * 1103 % 4096 ...> scramble(bzt::index_sequence<Indexes...>);
+
+template<std::size_t ... Indexes>
+bzt::integer_sequence<std::size_t, Indexes % 1000 ...> wrap(bzt::index_sequence<Indexes...>);
+
+using scrambled = decltype(scramble(bzt::make_index_sequence<4096>{}));
+using order = bzt::integer_sequence_argsort_t<scrambled>;
+
+static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<scrambled>, bzt::make_index_sequence<4096>>);
+static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<order>, scrambled>);
+static_assert(bzt::is_same_v<bzt::integer_sequence_unique_t<decltype(wrap(bzt::make_index_sequence<4096>{}))>,
+        bzt::make_index_sequence<1000>>);
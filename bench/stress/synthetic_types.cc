@@ -0,0 +1,58 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: trait queries over 1000 distinct synthetic classes, unions and enumerations.
+
+#include <utility>
+#include "bazaar_traits.hpp"
+#include "../synthetic_types.hpp"
+
+namespace bzt = bazaar::traits;
+using namespace synthetic;
+
+template<std::size_t I> struct profile;
+template<> struct profile<0> {static constexpr properties value{trivial};};
+template<> struct profile<1> {static constexpr properties value{empty};};
+template<> struct profile<2> {static constexpr properties value{non_trivial_copy};};
+template<> struct profile<3> {static constexpr properties value{throwing_constructors};};
+template<> struct profile<4> {static constexpr properties value{polymorphic};};
+template<> struct profile<5> {static constexpr properties value{non_copyable | non_trivial_destructor};};
+template<> struct profile<6> {static constexpr properties value{non_movable | empty};};
+template<> struct profile<7> {static constexpr properties value{non_default_constructible};};
+
+// Trivially copyable: trivial, empty, non_movable | empty (every copy and move deleted) and non_default_constructible.
+template<std::size_t I>
+using type = synthetic_class<I, profile<I % 8>::value>;
+
+template<typename> struct queries;
+template<std::size_t ... I>
+struct queries<std::index_sequence<I...>> {
+    static constexpr std::size_t trivially_copyable{(std::size_t{bzt::is_trivially_copyable_v<type<I>>} + ...)};
+    static constexpr std::size_t nothrow_swappable{(std::size_t{bzt::is_nothrow_swappable<type<I>>::value} + ...)};
+    static constexpr std::size_t empty{(std::size_t{bzt::is_empty_v<type<I>>} + ...)};
+    static constexpr std::size_t unions{(std::size_t{bzt::is_union_v<synthetic_union<I, I % 2 == 0>>} + ...)};
+    static constexpr std::size_t enums{(std::size_t{bzt::is_enum_v<synthetic_enum<I, unsigned char>>} + ...)};
+};
+
+constexpr std::size_t count{1000};
+using results = queries<std::make_index_sequence<count>>;
+static_assert(results::trivially_copyable == count / 8 * 4);
+static_assert(results::empty == count / 8 * 2);
+static_assert(results::unions == count);
+static_assert(results::enums == count);
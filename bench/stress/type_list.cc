@@ -0,0 +1,43 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Compile-time stress: size, at, index_of and contains over a type list of 10000 types.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+template<typename> struct tags;
+template<std::size_t ... I>
+struct tags<std::index_sequence<I...>> : public bzt::identity<bzt::type_list<tag<I>...>> {};
+
+using list = typename tags<std::make_index_sequence<10000>>::type;
+
+static_assert(bzt::type_list_size_v<list> == 10000);
+static_assert(bzt::is_same_v<bzt::type_list_front_t<list>, tag<0>>);
+static_assert(bzt::is_same_v<bzt::type_list_back_t<list>, tag<9999>>);
+static_assert(bzt::is_same_v<bzt::type_list_at_t<list, 5000>, tag<5000>>);
+static_assert(bzt::is_same_v<bzt::type_list_at_t<list, 7777>, tag<7777>>);
+static_assert(bzt::type_list_index_of_v<list, tag<4321>> == 4321);
+static_assert(bzt::type_list_contains_v<list, tag<9998>>);
+static_assert(!bzt::type_list_contains_v<list, tag<10000>>);
@@ -0,0 +1,45 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: transform, filter, partition and count_if over a type list of 4000 types.
+
+#include <utility>
+#include "bazaar_traits.hpp"
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+template<typename> struct is_odd;
+template<std::size_t I> struct is_odd<tag<I>> : public bzt::bool_constant<I % 2 == 1> {};
+
+template<typename> struct tags;
+template<std::size_t ... I>
+struct tags<std::index_sequence<I...>> : public bzt::identity<bzt::type_list<tag<I>...>> {};
+
+using list = typename tags<std::make_index_sequence<4000>>::type;
+
+static_assert(bzt::type_list_size_v<bzt::type_list_transform_t<list, bzt::add_pointer>> == 4000);
+using partition = bzt::type_list_partition_t<list, is_odd>;
+static_assert(bzt::is_same_v<bzt::type_list_back_t<partition::first_type>, tag<3999>>);
+static_assert(bzt::is_same_v<bzt::type_list_back_t<partition::second_type>, tag<3998>>);
+static_assert(bzt::type_list_count_if_v<list, is_odd> == 2000);
+static_assert(bzt::type_list_any_of_v<list, is_odd>);
+static_assert(!bzt::type_list_all_of_v<list, is_odd>);
@@ -0,0 +1,44 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: cartesian product of three type lists giving 8192 combinations, flatten of 1024 of them.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct input {};
+template<std::size_t I> struct output {};
+template<std::size_t I> struct policy {};
+
+template<template<std::size_t> typename Tag, typename Indexes> struct tags;
+template<template<std::size_t> typename Tag, std::size_t ... I>
+struct tags<Tag, std::index_sequence<I...>> : public bzt::identity<bzt::type_list<Tag<I>...>> {};
+
+using product = bzt::type_list_cartesian_product_t<typename tags<input, std::make_index_sequence<32>>::type,
+        typename tags<output, std::make_index_sequence<32>>::type,
+        typename tags<policy, std::make_index_sequence<8>>::type>;
+
+static_assert(bzt::type_list_size_v<product> == 8192);
+static_assert(bzt::is_same_v<bzt::type_list_front_t<product>, bzt::type_list<input<0>, output<0>, policy<0>>>);
+static_assert(bzt::is_same_v<bzt::type_list_back_t<product>, bzt::type_list<input<31>, output<31>, policy<7>>>);
+using pairs = bzt::type_list_cartesian_product_t<typename tags<input, std::make_index_sequence<32>>::type,
+        typename tags<output, std::make_index_sequence<32>>::type>;
+static_assert(bzt::type_list_size_v<bzt::type_list_flatten_t<pairs>> == 2 * 1024);
@@ -0,0 +1,44 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: index_of_if and find_if over a type list of 4000 types, at the default template depth.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+template<std::size_t Match>
+struct is_tag {
+    template<typename> struct apply : public bzt::false_type {};
+    template<std::size_t I> struct apply<tag<I>> : public bzt::bool_constant<I == Match> {};
+};
+
+template<typename> struct tags;
+template<std::size_t ... I>
+struct tags<std::index_sequence<I...>> : public bzt::identity<bzt::type_list<tag<I>...>> {};
+
+using list = typename tags<std::make_index_sequence<4000>>::type;
+
+static_assert(bzt::type_list_index_of_if_v<list, is_tag<3999>::apply> == 3999);
+static_assert(bzt::type_list_index_of_if_v<list, is_tag<4000>::apply> == 4000);
+static_assert(bzt::is_same_v<bzt::type_list_find_if_t<list, is_tag<2000>::apply>, tag<2000>>);
+static_assert(bzt::is_same_v<bzt::type_list_find_if_t<list, is_tag<3>::apply>, tag<3>>);
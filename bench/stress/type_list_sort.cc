@@ -0,0 +1,39 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Compile-time stress: padding minimizing sort of a type list of 1000 types.
+
+#include <utility>
+#include "integer_sequence.hpp"
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct alignas(1 << (I % 5)) field {char value[I % 7 + 1];};
+
+template<typename> struct fields;
+template<std::size_t ... I>
+struct fields<std::index_sequence<I...>> : public bzt::identity<bzt::type_list<field<I>...>> {};
+
+using sorted = bzt::type_list_sort_by_alignment<typename fields<std::make_index_sequence<1000>>::type>;
+
+static_assert(alignof(bzt::type_list_front_t<sorted::type>) == 16);
+static_assert(alignof(bzt::type_list_back_t<sorted::type>) == 1);
+static_assert(sorted::permutation::size() == 1000);
@@ -0,0 +1,39 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Compile-time stress: unique of a type list of 5000 types, each type appearing twice.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+// The 2500 tags in a scattered order, twice.
+template<typename> struct tags;
+template<std::size_t ... I>
+struct tags<std::index_sequence<I...>> : public bzt::identity<bzt::type_list<tag<I * 7919 % 2500>...>> {};
+
+using list = typename tags<std::make_index_sequence<5000>>::type;
+using unique = bzt::type_list_unique_t<list>;
+
+static_assert(bzt::type_list_size_v<unique> == 2500);
+static_assert(bzt::is_same_v<bzt::type_list_front_t<unique>, tag<0>>);
+static_assert(bzt::is_same_v<bzt::type_list_at_t<unique, 1>, tag<7919 % 2500>>);
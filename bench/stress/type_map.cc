@@ -0,0 +1,47 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Compile-time stress: lookups in type maps of 1000 and 10000 entries.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct key {};
+template<std::size_t I> struct value {};
+
+template<typename> struct entries;
+template<std::size_t ... I>
+struct entries<std::index_sequence<I...>> : public bzt::identity<bzt::type_map<bzt::type_pair<key<I>, value<I>>...>> {};
+
+template<std::size_t Size>
+using map = typename entries<std::make_index_sequence<Size>>::type;
+
+static_assert(bzt::is_same_v<bzt::type_map_at_t<map<1000>, key<0>>, value<0>>);
+static_assert(bzt::is_same_v<bzt::type_map_at_t<map<1000>, key<999>>, value<999>>);
+static_assert(!bzt::type_map_contains_v<map<1000>, key<1000>>);
+
+static_assert(bzt::is_same_v<bzt::type_map_at_t<map<10000>, key<0>>, value<0>>);
+static_assert(bzt::is_same_v<bzt::type_map_at_t<map<10000>, key<5000>>, value<5000>>);
+static_assert(bzt::is_same_v<bzt::type_map_at_t<map<10000>, key<9999>>, value<9999>>);
+static_assert(bzt::type_map_contains_v<map<10000>, key<1234>>);
+static_assert(!bzt::type_map_contains_v<map<10000>, value<1234>>);
+static_assert(bzt::type_map_insert_or_assign_t<map<10000>, key<10000>, void>::size() == 10001);
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Compile-time stress: membership queries over a type set of 5000 types, and unions and intersections of sets of
+// 1000 types.
+
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+template<std::size_t I> struct tag {};
+
+template<std::size_t Offset, typename> struct tags;
+template<std::size_t Offset, std::size_t ... I>
+struct tags<Offset, std::index_sequence<I...>> : public bzt::identity<bzt::type_set<tag<Offset + I>...>> {};
+
+template<std::size_t Offset, std::size_t Size>
+using tag_set = typename tags<Offset, std::make_index_sequence<Size>>::type;
+
+using large = tag_set<0, 5000>;
+static_assert(bzt::type_set_contains_v<large, tag<0>>);
+static_assert(bzt::type_set_contains_v<large, tag<2500>>);
+static_assert(bzt::type_set_contains_v<large, tag<4999>>);
+static_assert(!bzt::type_set_contains_v<large, tag<5000>>);
+static_assert(!bzt::type_set_contains_v<large, int>);
+
+template<typename> struct is_one_of_tags;
+template<std::size_t ... I>
+struct is_one_of_tags<std::index_sequence<I...>> : public bzt::impl::is_one_of<tag<4000>, tag<I>...> {};
+static_assert(is_one_of_tags<std::make_index_sequence<5000>>::value);
+
+static_assert(bzt::type_set_union_t<tag_set<0, 1000>, tag_set<500, 1000>>::size() == 1500);
+static_assert(bzt::is_same_v<bzt::type_set_intersection_t<tag_set<0, 1000>, tag_set<500, 1000>>, tag_set<500, 500>>);
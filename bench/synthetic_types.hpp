@@ -0,0 +1,149 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_BENCH_SYNTHETIC_TYPES_HPP
+#define BAZAAR_BENCH_SYNTHETIC_TYPES_HPP
+
+#include <cstddef>
+
+// Distinct types with controlled properties, for the benchmarks instantiating traits over thousands of types.
+// Every Id yields a new type, so synthetic_class<0, polymorphic> and synthetic_class<1, polymorphic> are
+// different classes with the same properties.
+namespace synthetic
+{
+    enum properties : unsigned {
+        trivial = 0u,
+        non_trivial_copy = 1u << 0u,        // User provided, noexcept, copy and move operations
+        throwing_constructors = 1u << 1u,   // User provided default, copy and move constructors, not noexcept
+        non_trivial_destructor = 1u << 2u,  // User provided destructor
+        polymorphic = 1u << 3u,             // Virtual destructor
+        non_copyable = 1u << 4u,            // Deleted copy operations, defaulted move operations
+        non_movable = 1u << 5u,             // Deleted copy and move operations
+        non_default_constructible = 1u << 6u, // Deleted default constructor
+        empty = 1u << 7u                    // No data member
+    };
+
+    constexpr properties operator|(properties lhs, properties rhs) noexcept {
+        return static_cast<properties>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+    }
+
+    namespace impl
+    {
+        // Each property is given by a base, empty when the property is not requested.
+        template<bool> struct storage {};
+        template<> struct storage<true> {[[maybe_unused]] int value;};
+
+        template<bool> struct non_trivial_copy_base {};
+        template<> struct non_trivial_copy_base<true> {
+            non_trivial_copy_base() = default;
+            non_trivial_copy_base(const non_trivial_copy_base &) noexcept {}
+            non_trivial_copy_base(non_trivial_copy_base &&) noexcept {}
+            non_trivial_copy_base& operator=(const non_trivial_copy_base &) noexcept {return *this;}
+            non_trivial_copy_base& operator=(non_trivial_copy_base &&) noexcept {return *this;}
+        };
+
+        template<bool> struct throwing_constructors_base {};
+        template<> struct throwing_constructors_base<true> {
+            throwing_constructors_base() {}
+            throwing_constructors_base(const throwing_constructors_base &) {}
+            throwing_constructors_base(throwing_constructors_base &&) {}
+            throwing_constructors_base& operator=(const throwing_constructors_base &) = default;
+            throwing_constructors_base& operator=(throwing_constructors_base &&) = default;
+        };
+
+        template<bool> struct non_trivial_destructor_base {};
+        template<> struct non_trivial_destructor_base<true> {
+            ~non_trivial_destructor_base() {}
+        };
+
+        template<bool> struct polymorphic_base {};
+        template<> struct polymorphic_base<true> {
+            virtual ~polymorphic_base() = default;
+        };
+
+        template<bool> struct non_copyable_base {};
+        template<> struct non_copyable_base<true> {
+            non_copyable_base() = default;
+            non_copyable_base(const non_copyable_base &) = delete;
+            non_copyable_base(non_copyable_base &&) = default;
+            non_copyable_base& operator=(const non_copyable_base &) = delete;
+            non_copyable_base& operator=(non_copyable_base &&) = default;
+        };
+
+        template<bool> struct non_movable_base {};
+        template<> struct non_movable_base<true> {
+            non_movable_base() = default;
+            non_movable_base(const non_movable_base &) = delete;
+            non_movable_base& operator=(const non_movable_base &) = delete;
+        };
+
+        template<bool> struct non_default_constructible_base {};
+        template<> struct non_default_constructible_base<true> {
+            non_default_constructible_base() = delete;
+        };
+    }
+
+    template<std::size_t Id, properties Properties = trivial>
+    struct synthetic_class :
+            public impl::storage<!(Properties & empty)>,
+            public impl::non_trivial_copy_base<bool(Properties & non_trivial_copy)>,
+            public impl::throwing_constructors_base<bool(Properties & throwing_constructors)>,
+            public impl::non_trivial_destructor_base<bool(Properties & non_trivial_destructor)>,
+            public impl::polymorphic_base<bool(Properties & polymorphic)>,
+            public impl::non_copyable_base<bool(Properties & non_copyable)>,
+            public impl::non_movable_base<bool(Properties & non_movable)>,
+            public impl::non_default_constructible_base<bool(Properties & non_default_constructible)> {
+        static constexpr std::size_t id{Id};
+    };
+
+    // Unions, trivial or holding a member with non trivial special members.
+    template<std::size_t Id, bool Trivial = true>
+    union synthetic_union {
+        [[maybe_unused]] int integer;
+        [[maybe_unused]] float floating;
+    };
+
+    template<std::size_t Id>
+    union synthetic_union<Id, false> {
+        synthetic_union() : integer() {}
+        synthetic_union(const synthetic_union &) {}
+        synthetic_union& operator=(const synthetic_union &) {return *this;}
+        ~synthetic_union() {}
+        [[maybe_unused]] int integer;
+        [[maybe_unused]] synthetic_class<Id, non_trivial_copy | non_trivial_destructor> object;
+    };
+
+    // Enumerations with a chosen underlying type.
+    namespace impl
+    {
+        template<std::size_t Id, typename Underlying>
+        struct enum_holder {
+            enum class scoped : Underlying {};
+            enum unscoped : Underlying {};
+        };
+    }
+
+    template<std::size_t Id, typename Underlying = int>
+    using synthetic_enum = typename impl::enum_holder<Id, Underlying>::scoped;
+
+    template<std::size_t Id, typename Underlying = int>
+    using synthetic_unscoped_enum = typename impl::enum_holder<Id, Underlying>::unscoped;
+}
+
+#endif //BAZAAR_BENCH_SYNTHETIC_TYPES_HPP
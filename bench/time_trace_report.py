@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Papa Libasse Sow.
+# https://github.com/Nandite/bazaar_traits
+# Distributed under the MIT Software License (X11 license).
+#
+# SPDX-License-Identifier: MIT
+
+"""Ranks the bazaar templates by the compile time they cost, from Clang -ftime-trace.
+
+The test translation units are compiled with -ftime-trace, then every
+InstantiateClass/InstantiateFunction event is attributed to its template (the
+event detail without its template arguments) and the templates are ranked by
+total time. Two times are reported: the inclusive one, which contains the
+nested instantiations an instantiation triggered, and the self one, which
+does not and tells where the time is really spent.
+"""
+
+import argparse
+import json
+import sys
+from collections import defaultdict
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, Iterable, List
+
+from bench_common import DEFAULT_FLAGS, compile_tu, markdown_table
+
+INSTANTIATION_EVENTS = ("InstantiateClass", "InstantiateFunction")
+
+
+@dataclass
+class Stats:
+    count: int = 0
+    total_us: float = 0.0
+    self_us: float = 0.0
+
+
+def template_name(detail: str) -> str:
+    """'bazaar::traits::impl::conjunction_impl<A, B>' -> 'bazaar::traits::impl::conjunction_impl'."""
+    index = 0
+    while index < len(detail):
+        if detail.startswith("operator", index):
+            # operator<, operator<<, operator<=... are part of the name.
+            index += len("operator")
+            while index < len(detail) and detail[index] in "<=>":
+                index += 1
+            continue
+        if detail[index] == "<":
+            return detail[:index].rstrip()
+        index += 1
+    return detail
+
+
+def aggregate(trace_files: Iterable[Path], prefix: str) -> Dict[str, Stats]:
+    stats: Dict[str, Stats] = defaultdict(Stats)
+    for trace_file in trace_files:
+        events = json.loads(trace_file.read_text()).get("traceEvents", [])
+        events = [event for event in events
+                  if event.get("ph") == "X" and event.get("name") in INSTANTIATION_EVENTS]
+        # Complete events of one thread nest, the self time of an event is its
+        # duration minus the one of its direct children.
+        events.sort(key=lambda event: (event.get("tid", 0), event["ts"], -event["dur"]))
+        stack: List[dict] = []
+        children_us: Dict[int, float] = defaultdict(float)
+        for index, event in enumerate(events):
+            event["_id"] = index
+            while stack and (stack[-1].get("tid", 0) != event.get("tid", 0)
+                             or stack[-1]["ts"] + stack[-1]["dur"] <= event["ts"]):
+                stack.pop()
+            if stack:
+                children_us[stack[-1]["_id"]] += event["dur"]
+            stack.append(event)
+        for event in events:
+            name = template_name(event.get("args", {}).get("detail", ""))
+            if not name.startswith(prefix):
+                continue
+            entry = stats[name]
+            entry.count += 1
+            entry.total_us += event["dur"]
+            entry.self_us += event["dur"] - children_us[event["_id"]]
+    return stats
+
+
+def build_traces(compiler: str, sources: Iterable[Path], include_dirs: List[Path], work_dir: Path) -> List[Path]:
+    work_dir.mkdir(parents=True, exist_ok=True)
+    traces = []
+    for source in sources:
+        output = work_dir / f"{source.stem}.o"
+        # Granularity 0 keeps the short instantiations, they are the majority.
+        flags = [*DEFAULT_FLAGS[:1], "-c", "-o", str(output), "-ftime-trace", "-ftime-trace-granularity=0"]
+        result = compile_tu(compiler, source, include_dirs, flags)
+        trace = output.with_suffix(".json")
+        if not trace.exists():
+            sys.exit(f"{compiler} produced no trace for {source}, -ftime-trace requires Clang 9 or newer.\n"
+                     f"{result.stderr}")
+        if not result.ok:
+            print(f"warning: {source.name} failed to compile, its trace is partial", file=sys.stderr)
+        traces.append(trace)
+    return traces
+
+
+def main() -> None:
+    root = Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="clang++", help="Clang compiler used to produce the traces")
+    parser.add_argument("--include", default=str(root / "include"), help="bazaar_traits include directory")
+    parser.add_argument("--work-dir", default="time_trace", help="where objects and traces are written")
+    parser.add_argument("--traces", nargs="*", help="aggregate these existing trace files instead of compiling")
+    parser.add_argument("--prefix", default="bazaar::", help="only report the templates starting with this")
+    parser.add_argument("--sort", choices=("total", "self", "count"), default="total", help="ranking key")
+    parser.add_argument("--top", type=int, default=30, help="number of templates reported")
+    parser.add_argument("sources", nargs="*", help="translation units to trace (default: tests/*.cc)")
+    args = parser.parse_args()
+
+    if args.traces:
+        traces = [Path(trace) for trace in args.traces]
+    else:
+        sources = [Path(source) for source in args.sources] or sorted((root / "tests").glob("*.cc"))
+        traces = build_traces(args.compiler, sources, [Path(args.include)], Path(args.work_dir))
+
+    stats = aggregate(traces, args.prefix)
+    key = {"total": lambda item: item[1].total_us,
+           "self": lambda item: item[1].self_us,
+           "count": lambda item: item[1].count}[args.sort]
+    ranked = sorted(stats.items(), key=key, reverse=True)[:args.top]
+    rows = [[rank, f"`{name}`", entry.count, f"{entry.total_us / 1000:.2f}", f"{entry.self_us / 1000:.2f}"]
+            for rank, (name, entry) in enumerate(ranked, start=1)]
+    print(markdown_table(["#", "template", "instantiations", "total ms", "self ms"], rows))
+
+
+if __name__ == "__main__":
+    main()
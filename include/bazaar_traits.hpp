@@ -21,12 +21,14 @@
 #define BAZAAR_TRAITS_HPP
 
 #include "logical_operators.hpp"
-#include "type_list.hpp"
+#include "cons_list.hpp"
 #include "macros.hpp"
 
-// Comment this line to use handwritten implementation of some traits
+// Comment this line (or define BAZAAR_TRAITS_NO_COMPILER_SUPPORT) to use handwritten implementation of some traits
 // instead of relying on the compiler to provides them trough keywords.
+#ifndef BAZAAR_TRAITS_NO_COMPILER_SUPPORT
 #define USE_COMPILER_SUPPORT_WHEN_POSSIBLE
+#endif
 
 namespace bazaar::traits {
 
@@ -824,6 +826,54 @@ namespace bazaar::traits {
     template<typename Tp>
     using make_unsigned_t [[maybe_unused]] = typename make_unsigned<Tp>::type;
 
+    // Smallest integer holding a value or a range: the first standard integer type, from the narrowest, whose range
+    // covers the bounds.
+    namespace impl
+    {
+        template<unsigned long long Max>
+        struct holds_unsigned_value {
+            template<typename Tp>
+            using apply = bool_constant<(Max <= static_cast<Tp>(-1))>;
+        };
+
+        // The fast variant is never narrower than unsigned int, the operands narrower than int being promoted.
+        template<unsigned long long Max>
+        struct holds_unsigned_value_fast {
+            template<typename Tp>
+            using apply = bool_constant<(Max <= static_cast<Tp>(-1) && sizeof(Tp) >= sizeof(unsigned int))>;
+        };
+
+        template<long long Min, long long Max>
+        struct holds_signed_range {
+            template<typename Tp>
+            using apply = bool_constant<(Max <= static_cast<Tp>(static_cast<make_unsigned_t<Tp>>(-1) >> 1u) &&
+                    Min >= -static_cast<Tp>(static_cast<make_unsigned_t<Tp>>(-1) >> 1u) - 1)>;
+        };
+    }
+
+    template<unsigned long long Max>
+    struct uint_least_for_value : public impl::find_first_element_if<unsigned_types_list,
+            impl::holds_unsigned_value<Max>::template apply> {};
+
+    template<unsigned long long Max>
+    using uint_least_for_value_t [[maybe_unused]] = typename uint_least_for_value<Max>::type;
+
+    template<unsigned long long Max>
+    struct uint_fast_for_value : public impl::find_first_element_if<unsigned_types_list,
+            impl::holds_unsigned_value_fast<Max>::template apply> {};
+
+    template<unsigned long long Max>
+    using uint_fast_for_value_t [[maybe_unused]] = typename uint_fast_for_value<Max>::type;
+
+    template<long long Min, long long Max>
+    struct int_least_for_range : public impl::find_first_element_if<signed_types_list,
+            impl::holds_signed_range<Min, Max>::template apply> {
+        static_assert(Min <= Max, "bzt::int_least_for_range requires Min <= Max");
+    };
+
+    template<long long Min, long long Max>
+    using int_least_for_range_t [[maybe_unused]] = typename int_least_for_range<Min, Max>::type;
+
     //-------------------------------------------------------------------------------------------
     // Member introspection
     //-------------------------------------------------------------------------------------------
@@ -1282,7 +1332,7 @@ namespace bazaar::traits {
     template<typename Tp> [[maybe_unused]] inline constexpr auto is_aggregate_v{is_aggregate<Tp>::value};
 
     // Is no throw constructible
-#if __has_keyword(__is_nothrow_constructible)
+#if __has_keyword(__is_nothrow_constructible) && defined(USE_COMPILER_SUPPORT_WHEN_POSSIBLE)
     template<typename Tp, typename ... Args>
     struct is_nothrow_constructible : public bool_constant<__is_nothrow_constructible(Tp, Args...)>{
         static_assert(impl::is_complete_or_unbounded_v<Tp>,
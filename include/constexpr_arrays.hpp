@@ -0,0 +1,122 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_CONSTEXPR_ARRAYS_HPP
+#define BAZAAR_CONSTEXPR_ARRAYS_HPP
+
+#include <cstddef>
+#include "helper_traits.hpp"
+#include "sequence_generator.hpp"
+
+// Constexpr functions over arrays, shared by the algorithms of type_list.hpp, integer_sequence.hpp and
+// trait_mask.hpp. A pack is expanded once into an array, the loop runs in a constexpr function and the result is read
+// back in a single expansion, so that neither the depth nor the number of instantiations depends on the length of
+// the pack.
+//
+// An array cannot be empty, so the input arrays start with an unused element: a pack is passed as
+// {false, Pred<Tp>::value...} or {Tp{}, Values...}, and the element I of the pack is at index I + 1. The arrays
+// returned hold the results from index 0, with one more element than the pack for the same reason.
+namespace bazaar::traits {
+
+    namespace impl
+    {
+        template<std::size_t N>
+        constexpr std::size_t find_first_true(const bool (&values)[N]) noexcept {
+            for (std::size_t i{1}; i < N; ++i) {
+                if (values[i]) return i - 1;
+            }
+            return N - 1;
+        }
+
+        template<std::size_t N>
+        constexpr std::size_t count_true(const bool (&values)[N]) noexcept {
+            std::size_t count{0};
+            for (std::size_t i{1}; i < N; ++i) count += values[i];
+            return count;
+        }
+
+        // The positions of the elements flagged by a mask
+        template<std::size_t N>
+        struct kept_positions {
+            std::size_t value[N + 1];
+            std::size_t size;
+        };
+
+        template<std::size_t N>
+        constexpr kept_positions<N> make_kept_positions(const bool (&keep)[N + 1]) noexcept {
+            kept_positions<N> positions{{}, 0};
+            for (std::size_t i{1}; i <= N; ++i) {
+                if (keep[i]) positions.value[positions.size++] = i - 1;
+            }
+            return positions;
+        }
+
+        template<std::size_t N>
+        struct positions_array {
+            std::size_t value[N + 1]; // One more element keeping the array non empty when N is 0
+        };
+
+        // Stable bottom-up merge sort of the positions of N keys, in a constexpr function so that the sort does not
+        // recurse over templates. The keys are read from a local copy and the passes alternate between two buffers: GCC
+        // is an order of magnitude slower when each comparison reads the static array of the caller.
+        template<std::size_t N, typename Key, typename Before>
+        constexpr positions_array<N> stable_sort_positions(const Key (&keys)[N + 1], Before before) noexcept {
+            Key local[N + 1]{};
+            for (std::size_t i{0}; i <= N; ++i) local[i] = keys[i];
+            std::size_t buffers[2][N + 1]{};
+            for (std::size_t i{0}; i < N; ++i) buffers[0][i] = i;
+            std::size_t from{0};
+            for (std::size_t width{1}; width < N; width *= 2, from = 1 - from) {
+                const auto &order{buffers[from]};
+                auto &merged{buffers[1 - from]};
+                for (std::size_t left{0}; left < N; left += 2 * width) {
+                    const auto middle{left + width < N ? left + width : N};
+                    const auto right{left + 2 * width < N ? left + 2 * width : N};
+                    auto i{left}, j{middle}, k{left};
+                    while (i < middle && j < right) {
+                        merged[k++] = before(local[order[j] + 1], local[order[i] + 1]) ? order[j++] : order[i++];
+                    }
+                    while (i < middle) merged[k++] = order[i++];
+                    while (j < right) merged[k++] = order[j++];
+                }
+            }
+            positions_array<N> sorted{};
+            for (std::size_t i{0}; i < N; ++i) sorted.value[i] = buffers[from][i];
+            return sorted;
+        }
+
+        template<std::size_t N>
+        constexpr positions_array<N> inverse_positions(const positions_array<N> &positions) noexcept {
+            positions_array<N> inverse{};
+            for (std::size_t i{0}; i < N; ++i) inverse.value[positions.value[i]] = i;
+            return inverse;
+        }
+
+        // The values held by a static array at the given indexes as an integer sequence. The array is given by
+        // reference, its values are read in the expansion rather than passed as a pack.
+        template<typename Tp, const auto &Positions, typename Indexes>
+        struct positions_sequence;
+
+        template<typename Tp, const auto &Positions, std::size_t ... Indexes>
+        struct positions_sequence<Tp, Positions, integer_sequence<std::size_t, Indexes...>> :
+                public identity<integer_sequence<Tp, Positions.value[Indexes]...>> {};
+    }
+}
+
+#endif //BAZAAR_CONSTEXPR_ARRAYS_HPP
@@ -0,0 +1,42 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_FNV1A_HASH_HPP
+#define BAZAAR_FNV1A_HASH_HPP
+
+#include <cstddef>
+
+// The 64 bits FNV-1a hash, shared by type_hash.hpp and type_list.hpp. It takes a pointer and a size rather than a
+// std::string_view so that type_list.hpp does not bring <string_view> in.
+namespace bazaar::traits {
+
+    namespace impl
+    {
+        // Unsigned long long holds at least 64 bits, and the low 64 bits of the hash do not depend on the higher ones.
+        constexpr unsigned long long fnv1a(const char *bytes, const std::size_t size) noexcept {
+            unsigned long long hash{14695981039346656037ull};
+            for (std::size_t i{0}; i < size; ++i) {
+                hash = ((hash ^ static_cast<unsigned char>(bytes[i])) * 1099511628211ull) & 0xffffffffffffffffull;
+            }
+            return hash;
+        }
+    }
+}
+
+#endif //BAZAAR_FNV1A_HASH_HPP
@@ -21,6 +21,7 @@
 #define HELPER_TRAITS_HPP
 
 #include "integral_constant.hpp"
+#include "macros.hpp"
 
 namespace bazaar::traits
 {
@@ -92,17 +93,16 @@ namespace bazaar::traits
     template<typename Tp, typename Up>
     [[maybe_unused]] inline constexpr bool is_not_same_v = is_not_same<Tp, Up>::value;
 
-    // Is one of
+    // Is one of, a fold expression over the sequence: neither the depth nor, with the builtin, the number of
+    // instantiations depends on its length.
     namespace impl
     {
-        template<typename, typename ...> struct is_one_of_impl;
-        template<typename Tp> struct is_one_of_impl <Tp> : public false_type {};
-        template<typename Tp, typename ... Sequence> struct is_one_of_impl<Tp, Tp, Sequence...> :  public true_type {};
-        template<typename Tp, typename Up, typename ... Sequence>
-        struct is_one_of_impl<Tp, Up, Sequence...> : public is_one_of_impl<Tp, Sequence...>{};
-
         template<typename Tp, typename ... Sequence>
-        struct is_one_of : public impl::is_one_of_impl<Tp, Sequence...> {};
+#if BZT_HAS_BUILTIN(__is_same)
+        struct is_one_of : public bool_constant<(__is_same(Tp, Sequence) || ...)> {};
+#else
+        struct is_one_of : public bool_constant<(is_same_impl<Tp, Sequence>::value || ...)> {};
+#endif
 
         template<typename Tp, typename ... Sequence>
         [[maybe_unused]] static constexpr auto is_one_of_v {is_one_of<Tp, Sequence...>::value};
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include "bazaar_traits.hpp"
+#include "constexpr_arrays.hpp"
 
 namespace bazaar::traits {
 
@@ -36,39 +37,8 @@ namespace bazaar::traits {
 
     namespace impl
     {
-        template<std::size_t ... Sequence>
-        struct convertible_index_sequence {
-            using type = convertible_index_sequence;
-
-            template<template<typename Up, Up ...> typename NewSequence, typename NewType>
-            using convert = NewSequence<NewType, Sequence...>;
-        };
-
-        template<typename I1, typename I2>
-        struct merge_recount_sequence;
-
-        template<std::size_t ... LeftSequence, std::size_t ... RightSequence>
-        struct merge_recount_sequence<convertible_index_sequence<LeftSequence...>,
-                convertible_index_sequence<RightSequence...>>
-                : public convertible_index_sequence<LeftSequence..., (sizeof...(LeftSequence) +
-                                                                                   RightSequence)...> {
-        };
-
-        template<std::size_t N>
-        struct make_index_sequence_impl : merge_recount_sequence<
-                typename make_index_sequence_impl<N/2>::type,
-                typename make_index_sequence_impl<N - N/2>::type
-                >{};
-
-        template<> struct make_index_sequence_impl<0> : convertible_index_sequence<> {};
-        template<> struct make_index_sequence_impl<1> : convertible_index_sequence<0> {};
-
-        template<typename Tp, Tp N>
-        using make_integer_sequence_nocheck =
-                typename make_index_sequence_impl<N>::template convert<integer_sequence, Tp>;
-
         template<typename Tp, Tp N>
-        struct make_integer_sequence_checked : public identity<make_integer_sequence_nocheck<Tp,  N >= 0 ? N : 0>>
+        struct make_integer_sequence_checked : public identity<integer_sequence_of<Tp,  N >= 0 ? N : 0>>
         {
             static_assert(is_integral_v<Tp>, "bzt::make_integer_sequence requires an integral type");
             static_assert(N >= 0, "bzt::make_integer_sequence must have a non-negative sequence length");
@@ -76,20 +46,361 @@ namespace bazaar::traits {
 
     }
 
+    // The builtins reject the negative lengths themselves.
     template<std::size_t N>
-    using make_index_sequence = typename impl::make_index_sequence_impl<N>
-            ::template convert<integer_sequence, std::size_t>;
+    using make_index_sequence = impl::index_sequence_of<N>;
 
     template<typename Tp, Tp N>
     using make_integer_sequence =
-#if BZT_HAS_BUILTIN(__make_integer_seq)// Clang
-            __make_integer_seq<integer_sequence, Tp, N>;
-#else       // Other compilers
+#ifdef BZT_HAS_INTEGER_SEQUENCE_BUILTIN
+            impl::integer_sequence_of<Tp, N>;
+#else
             typename impl::make_integer_sequence_checked<Tp,N>::type;
 #endif
 
     template<typename ... Tp>
     using index_sequence_for = make_index_sequence<sizeof ... (Tp)>;
+
+    // Integer range, Begin, Begin + Step... up to End excluded, Step being negative to count down. The elements are
+    // computed in a single expansion over an index sequence of the length of the range. The arithmetic is carried
+    // out on unsigned long long, so that neither the length nor the intermediate values can overflow.
+    namespace impl
+    {
+        template<typename Tp>
+        constexpr std::size_t integer_range_size(Tp begin, Tp end, Tp step) noexcept {
+            using Up = unsigned long long;
+            if (step > 0 ? end <= begin : begin <= end) return 0;
+            const Up distance{step > 0 ? Up(end) - Up(begin) : Up(begin) - Up(end)};
+            const Up stride{step > 0 ? Up(step) : Up{0} - Up(step)};
+            return static_cast<std::size_t>(distance / stride + (distance % stride != 0));
+        }
+
+        template<typename Tp, Tp Begin, Tp Step, typename Indexes>
+        struct integer_range_elements;
+
+        template<typename Tp, Tp Begin, Tp Step, std::size_t ... Indexes>
+        struct integer_range_elements<Tp, Begin, Step, integer_sequence<std::size_t, Indexes...>> :
+                public identity<integer_sequence<Tp, static_cast<Tp>(static_cast<unsigned long long>(Begin) +
+                        static_cast<unsigned long long>(Indexes) * static_cast<unsigned long long>(Step))...>> {};
+
+        template<typename Tp, Tp Begin, Tp End, Tp Step>
+        struct integer_range : public integer_range_elements<Tp, Begin, Step,
+                index_sequence_of<integer_range_size<Tp>(Begin, End, Step != 0 ? Step : 1)>> {
+            static_assert(is_integral_v<Tp>, "bzt::make_integer_range requires an integral type");
+            static_assert(Step != 0, "bzt::make_integer_range requires a non-zero step");
+        };
+    }
+
+    template<typename Tp, Tp Begin, Tp End, Tp Step = 1>
+    using make_integer_range = typename impl::integer_range<Tp, Begin, End, Step>::type;
+
+    template<std::size_t Begin, std::size_t End, std::size_t Step = 1>
+    using make_index_range = make_integer_range<std::size_t, Begin, End, Step>;
+
+    //-------------------------------------------------------------------------------------------
+    // Integer sequence algorithms
+    //-------------------------------------------------------------------------------------------
+
+    // The values of a sequence are copied in an array, the algorithm runs over it in a constexpr function and the
+    // resulting sequence is read back from the array in a single expansion, so the depth does not depend on the
+    // length of the sequence. The input arrays start with an unused element, as in constexpr_arrays.hpp.
+    namespace impl
+    {
+        template<typename Tp, std::size_t N>
+        struct values_array {
+            Tp value[N + 1]; // One more element keeping the array non empty when N is 0
+        };
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> copy_values(const Tp (&values)[N + 1]) noexcept {
+            values_array<Tp, N> copy{};
+            for (std::size_t i{0}; i < N; ++i) copy.value[i] = values[i + 1];
+            return copy;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> reverse_values(const Tp (&values)[N + 1]) noexcept {
+            values_array<Tp, N> reversed{};
+            for (std::size_t i{0}; i < N; ++i) reversed.value[i] = values[N - i];
+            return reversed;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> inclusive_scan_values(const Tp (&values)[N + 1]) noexcept {
+            values_array<Tp, N> scan{};
+            Tp sum{0};
+            for (std::size_t i{0}; i < N; ++i) scan.value[i] = sum = static_cast<Tp>(sum + values[i + 1]);
+            return scan;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> exclusive_scan_values(const Tp (&values)[N + 1]) noexcept {
+            values_array<Tp, N> scan{};
+            Tp sum{0};
+            for (std::size_t i{0}; i < N; ++i) {
+                scan.value[i] = sum;
+                sum = static_cast<Tp>(sum + values[i + 1]);
+            }
+            return scan;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr Tp sum_values(const Tp (&values)[N + 1]) noexcept {
+            Tp sum{0};
+            for (std::size_t i{1}; i <= N; ++i) sum = static_cast<Tp>(sum + values[i]);
+            return sum;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr Tp product_values(const Tp (&values)[N + 1]) noexcept {
+            Tp product{1};
+            for (std::size_t i{1}; i <= N; ++i) product = static_cast<Tp>(product * values[i]);
+            return product;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr Tp value_at(const Tp (&values)[N + 1], std::size_t index) noexcept {
+            return values[index + 1];
+        }
+
+        template<typename Sequence>
+        struct concatenated_sequence : public identity<Sequence> {};
+
+        template<typename Tp, Tp ... Left, Tp ... Right>
+        concatenated_sequence<integer_sequence<Tp, Left..., Right...>> operator+(
+                concatenated_sequence<integer_sequence<Tp, Left...>>,
+                concatenated_sequence<integer_sequence<Tp, Right...>>);
+    }
+
+    // Concat, the values of the sequences in their order, merged by a fold expression. The sequences must share their
+    // value type.
+    template<typename Sequence, typename ... Sequences>
+    struct integer_sequence_concat : public
+            decltype((impl::concatenated_sequence<Sequence>{} + ... + impl::concatenated_sequence<Sequences>{})) {};
+
+    template<typename Sequence, typename ... Sequences>
+    using integer_sequence_concat_t [[maybe_unused]] = typename integer_sequence_concat<Sequence, Sequences...>::type;
+
+    // Reverse
+    template<typename Sequence> struct integer_sequence_reverse;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_reverse<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto reversed{impl::reverse_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, reversed, impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_reverse_t [[maybe_unused]] = typename integer_sequence_reverse<Sequence>::type;
+
+    // Inclusive scan, the I-th value being the sum of the values up to the I-th included
+    template<typename Sequence> struct integer_sequence_inclusive_scan;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_inclusive_scan<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto scan{impl::inclusive_scan_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, scan, impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_inclusive_scan_t [[maybe_unused]] = typename integer_sequence_inclusive_scan<Sequence>::type;
+
+    // Exclusive scan, the I-th value being the sum of the values before the I-th, which gives the offsets of packed
+    // fields from their sizes
+    template<typename Sequence> struct integer_sequence_exclusive_scan;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_exclusive_scan<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto scan{impl::exclusive_scan_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, scan, impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_exclusive_scan_t [[maybe_unused]] = typename integer_sequence_exclusive_scan<Sequence>::type;
+
+    // Sum and product, 0 and 1 for an empty sequence
+    template<typename Sequence> struct integer_sequence_sum;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_sum<integer_sequence<Tp, Values...>> : public
+            integral_constant<Tp, impl::sum_values<Tp, sizeof ...(Values)>({Tp{}, Values...})> {};
+
+    template<typename Sequence>
+    [[maybe_unused]] inline constexpr auto integer_sequence_sum_v{integer_sequence_sum<Sequence>::value};
+
+    template<typename Sequence> struct integer_sequence_product;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_product<integer_sequence<Tp, Values...>> : public
+            integral_constant<Tp, impl::product_values<Tp, sizeof ...(Values)>({Tp{}, Values...})> {};
+
+    template<typename Sequence>
+    [[maybe_unused]] inline constexpr auto integer_sequence_product_v{integer_sequence_product<Sequence>::value};
+
+    // At
+    template<typename Sequence, std::size_t Index> struct integer_sequence_at;
+
+    template<typename Tp, Tp ... Values, std::size_t Index>
+    struct integer_sequence_at<integer_sequence<Tp, Values...>, Index> : public
+            integral_constant<Tp, impl::value_at<Tp, sizeof ...(Values)>({Tp{}, Values...}, Index)> {
+        static_assert(Index < sizeof ...(Values), "bzt::integer_sequence_at index out of range");
+    };
+
+    template<typename Sequence, std::size_t Index>
+    [[maybe_unused]] inline constexpr auto integer_sequence_at_v{integer_sequence_at<Sequence, Index>::value};
+
+    // Select, the values at the given indexes in their order, an index being selectable several times
+    template<typename Sequence, typename Indexes> struct integer_sequence_select;
+
+    template<typename Tp, Tp ... Values, std::size_t ... Indexes>
+    struct integer_sequence_select<integer_sequence<Tp, Values...>, integer_sequence<std::size_t, Indexes...>> {
+        static_assert(impl::count_true<sizeof ...(Indexes) + 1>({false, (Indexes < sizeof ...(Values))...}) ==
+                      sizeof ...(Indexes), "bzt::integer_sequence_select index out of range");
+    private:
+        static constexpr auto values{impl::copy_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, values, integer_sequence<std::size_t, Indexes...>>::type;
+    };
+
+    template<typename Sequence, typename Indexes>
+    using integer_sequence_select_t [[maybe_unused]] = typename integer_sequence_select<Sequence, Indexes>::type;
+
+    //-------------------------------------------------------------------------------------------
+    // Integer sequence sort
+    //-------------------------------------------------------------------------------------------
+
+    // The values are ordered by the stable merge sort of type_list_sort_by_alignment, a constexpr function looping
+    // over the positions, so that neither the depth nor the number of instantiations depends on the length of the
+    // sequence. The evaluation is bounded by the constexpr limits instead: Clang counts a step per statement, about
+    // 4 * N * log2(N) for a sort of N values, 200000 for 4096 values against a default -fconstexpr-steps of 1048576.
+    // Sequences beyond 16000 values need a larger -fconstexpr-steps, and beyond 262144 values GCC needs a larger
+    // -fconstexpr-loop-limit.
+    namespace impl
+    {
+        template<typename Tp, std::size_t N>
+        struct kept_values {
+            Tp value[N + 1];
+            std::size_t size;
+        };
+
+        template<typename Tp>
+        constexpr bool is_less_value(const Tp &lhs, const Tp &rhs) noexcept {
+            return lhs < rhs;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> sort_values(const Tp (&values)[N + 1]) noexcept {
+            const auto order{stable_sort_positions<N>(values, is_less_value<Tp>)};
+            values_array<Tp, N> sorted{};
+            for (std::size_t i{0}; i < N; ++i) sorted.value[i] = values[order.value[i] + 1];
+            return sorted;
+        }
+
+        // The first of each run of equal values in the stable order is their first occurrence, which is kept in its
+        // place.
+        template<typename Tp, std::size_t N>
+        constexpr kept_values<Tp, N> unique_values(const Tp (&values)[N + 1]) noexcept {
+            const auto order{stable_sort_positions<N>(values, is_less_value<Tp>)};
+            bool first[N + 1]{};
+            for (std::size_t i{0}; i < N; ++i) {
+                first[order.value[i]] = i == 0 || values[order.value[i - 1] + 1] < values[order.value[i] + 1];
+            }
+            kept_values<Tp, N> unique{{}, 0};
+            for (std::size_t i{0}; i < N; ++i) {
+                if (first[i]) unique.value[unique.size++] = values[i + 1];
+            }
+            return unique;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr bool is_permutation_values(const Tp (&values)[N + 1]) noexcept {
+            bool seen[N + 1]{};
+            for (std::size_t i{1}; i <= N; ++i) {
+                // A negative value converts to a size beyond N
+                const auto index{static_cast<std::size_t>(values[i])};
+                if (index >= N || seen[index]) return false;
+                seen[index] = true;
+            }
+            return true;
+        }
+
+        template<typename Tp, std::size_t N>
+        constexpr values_array<Tp, N> inverse_values(const Tp (&values)[N + 1]) noexcept {
+            values_array<Tp, N> inverse{};
+            for (std::size_t i{0}; i < N; ++i) {
+                inverse.value[static_cast<std::size_t>(values[i + 1])] = static_cast<Tp>(i);
+            }
+            return inverse;
+        }
+    }
+
+    // Sort, the values in increasing order
+    template<typename Sequence> struct integer_sequence_sort;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_sort<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto sorted{impl::sort_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, sorted, impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_sort_t [[maybe_unused]] = typename integer_sequence_sort<Sequence>::type;
+
+    // Argsort, the original index of each value of the sorted sequence, equal values keeping their order
+    template<typename Sequence> struct integer_sequence_argsort;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_argsort<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto order{impl::stable_sort_positions<sizeof ...(Values)>({Tp{}, Values...},
+                                                                                  impl::is_less_value<Tp>)};
+    public:
+        using type = typename impl::positions_sequence<std::size_t, order,
+                impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_argsort_t [[maybe_unused]] = typename integer_sequence_argsort<Sequence>::type;
+
+    // Inverse permutation, the index of each value of a permutation of 0 to N - 1 in this permutation: the inverse of
+    // an argsort gives the sorted index of each original value.
+    template<typename Sequence> struct integer_sequence_inverse_permutation;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_inverse_permutation<integer_sequence<Tp, Values...>> {
+        static_assert(impl::is_permutation_values<Tp, sizeof ...(Values)>({Tp{}, Values...}),
+                      "bzt::integer_sequence_inverse_permutation the sequence is not a permutation");
+    private:
+        static constexpr auto inverse{impl::inverse_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, inverse, impl::index_sequence_of<sizeof ...(Values)>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_inverse_permutation_t [[maybe_unused]] =
+            typename integer_sequence_inverse_permutation<Sequence>::type;
+
+    // Unique, the first occurrence of each value in their order
+    template<typename Sequence> struct integer_sequence_unique;
+
+    template<typename Tp, Tp ... Values>
+    struct integer_sequence_unique<integer_sequence<Tp, Values...>> {
+    private:
+        static constexpr auto unique{impl::unique_values<Tp, sizeof ...(Values)>({Tp{}, Values...})};
+    public:
+        using type = typename impl::positions_sequence<Tp, unique, impl::index_sequence_of<unique.size>>::type;
+    };
+
+    template<typename Sequence>
+    using integer_sequence_unique_t [[maybe_unused]] = typename integer_sequence_unique<Sequence>::type;
 }
 
 #endif //INTEGER_SEQUENCE_HPP
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_SEQUENCE_GENERATOR_HPP
+#define BAZAAR_SEQUENCE_GENERATOR_HPP
+
+#include <cstddef>
+#include "macros.hpp"
+
+// Index sequence generation, shared by type_list.hpp and integer_sequence.hpp.
+namespace bazaar::traits {
+
+    // Defined in integer_sequence.hpp. The sequences are made by the builtin of the compiler when there is one:
+    // __make_integer_seq for Clang, __integer_pack for GCC. This header is included without bazaar_traits.hpp, which
+    // defines USE_COMPILER_SUPPORT_WHEN_POSSIBLE, hence the test of the option itself.
+    template<typename Tp, Tp ... Idx> struct integer_sequence;
+    namespace impl
+    {
+        template<std::size_t ... Sequence>
+        struct convertible_index_sequence {
+            using type = convertible_index_sequence;
+
+            template<template<typename Up, Up ...> typename NewSequence, typename NewType>
+            using convert = NewSequence<NewType, Sequence...>;
+        };
+
+        // Portable generator, used when the compiler has no builtin. The sequence of N is the sequence of N / 2
+        // doubled, followed by N - 1 when N is odd: one instantiation per bit of N. N / 2 being N without its last
+        // bit, the lengths sharing their leading bits share the instantiations made for these bits.
+        template<typename Sequence, bool Odd>
+        struct double_index_sequence;
+
+        template<std::size_t ... Sequence>
+        struct double_index_sequence<convertible_index_sequence<Sequence...>, false>
+                : public convertible_index_sequence<Sequence..., (sizeof...(Sequence) + Sequence)...> {
+        };
+
+        template<std::size_t ... Sequence>
+        struct double_index_sequence<convertible_index_sequence<Sequence...>, true>
+                : public convertible_index_sequence<Sequence..., (sizeof...(Sequence) + Sequence)...,
+                                                    2 * sizeof...(Sequence)> {
+        };
+
+        template<std::size_t N>
+        struct make_index_sequence_impl : double_index_sequence<
+                typename make_index_sequence_impl<N / 2>::type,
+                N % 2 == 1
+                >{};
+
+        template<> struct make_index_sequence_impl<0> : convertible_index_sequence<> {};
+
+#if !defined(BAZAAR_TRAITS_NO_COMPILER_SUPPORT) && (BZT_HAS_BUILTIN(__make_integer_seq))
+#define BZT_HAS_INTEGER_SEQUENCE_BUILTIN
+        template<typename Tp, Tp N>
+        using integer_sequence_of = __make_integer_seq<integer_sequence, Tp, N>;
+#elif !defined(BAZAAR_TRAITS_NO_COMPILER_SUPPORT) && (BZT_HAS_BUILTIN(__integer_pack))
+#define BZT_HAS_INTEGER_SEQUENCE_BUILTIN
+        template<typename Tp, Tp N>
+        using integer_sequence_of = integer_sequence<Tp, __integer_pack(N)...>;
+#else
+        template<typename Tp, Tp N>
+        using integer_sequence_of = typename make_index_sequence_impl<N>::template convert<integer_sequence, Tp>;
+#endif
+
+        template<std::size_t N>
+        using index_sequence_of = integer_sequence_of<std::size_t, N>;
+    }
+}
+
+#endif //BAZAAR_SEQUENCE_GENERATOR_HPP
@@ -116,6 +116,9 @@ namespace bazaar
     template<typename Tp> struct is_unsigned;
     template<typename Tp> struct make_signed;
     template<typename Tp> struct make_unsigned;
+    template<unsigned long long Max> struct uint_least_for_value;
+    template<unsigned long long Max> struct uint_fast_for_value;
+    template<long long Min, long long Max> struct int_least_for_range;
 
     // Member introspection:
     template<typename Tp, typename ... Args>    struct is_constructible;
@@ -173,6 +176,67 @@ namespace bazaar
     template<typename ...> struct common_type
     template<typename Tp> struct underlying_type;
 
+    //-------------------------------------------------------------------------------------------
+    // type_list.hpp
+    //-------------------------------------------------------------------------------------------
+    template<typename Head, typename Next> using type_list_t;
+    template<typename ... Tp> struct type_list;
+    template<typename List> struct type_list_size;
+    template<typename List, std::size_t Index> struct type_list_at;
+    template<typename List> using type_list_front_t;
+    template<typename List> using type_list_back_t;
+    template<typename List, typename Up> struct type_list_index_of;
+    template<typename List, typename Up> struct type_list_contains;
+    template<typename ConsList> struct type_list_from_cons;
+    template<typename List> struct type_list_to_cons;
+    template<typename ... Tp> struct type_set;
+    template<typename Set, typename Up> struct type_set_contains;
+    template<typename Set, typename Up> struct type_set_insert;
+    template<typename Set1, typename Set2> struct type_set_union;
+    template<typename Set1, typename Set2> struct type_set_intersection;
+    template<typename Key, typename Value> struct type_pair;
+    template<typename ... Pairs> struct type_map;
+    template<typename Map, typename Key> struct type_map_at;
+    template<typename Map, typename Key> struct type_map_contains;
+    template<typename Map, typename Key, typename Value> struct type_map_insert_or_assign;
+    template<typename Map> struct type_map_keys;
+    template<typename Map> struct type_map_values;
+    template<typename List> struct type_list_sort_by_alignment;
+    template<typename List, template<typename> typename F> struct type_list_transform;
+    template<typename List, template<typename> typename Pred> struct type_list_filter;
+    template<typename List, template<typename> typename Pred> struct type_list_remove_if;
+    template<typename List, template<typename> typename Pred> struct type_list_partition;
+    template<typename List, template<typename> typename Pred> struct type_list_count_if;
+    template<typename List, template<typename> typename Pred> struct type_list_all_of;
+    template<typename List, template<typename> typename Pred> struct type_list_any_of;
+    template<typename List, template<typename> typename Pred> struct type_list_none_of;
+    template<typename List, template<typename> typename Pred> struct type_list_index_of_if;
+    template<typename List, template<typename> typename Pred> struct type_list_find_if;
+    template<typename List, template<typename> typename F> struct type_list_transform_view;
+    template<typename List, template<typename> typename Pred> struct type_list_filter_view;
+    template<typename List> struct type_list_unique;
+    template<typename ... Lists> struct type_list_concat;
+    template<typename List> struct type_list_flatten;
+    template<typename ... Lists> struct type_list_cartesian_product;
+
+    //-------------------------------------------------------------------------------------------
+    // type_hash.hpp
+    //-------------------------------------------------------------------------------------------
+    template<typename Tp> struct type_name;
+    template<typename Tp> struct type_hash;
+
+    //-------------------------------------------------------------------------------------------
+    // type_table.hpp
+    //-------------------------------------------------------------------------------------------
+    struct type_descriptor;
+    template<typename Tp> struct type_descriptor_of;
+    template<typename List> struct type_table;
+
+    //-------------------------------------------------------------------------------------------
+    // trait_mask.hpp
+    //-------------------------------------------------------------------------------------------
+    template<typename Tp, template<typename> typename ... Traits> struct trait_mask;
+
     // Todo : implement theses
     template <class Fn, class... ArgTypes> struct is_invocable;
     template <class R, class Fn, class... ArgTypes> struct is_invocable_r;
@@ -0,0 +1,99 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_TRAIT_MASK_HPP
+#define BAZAAR_TRAIT_MASK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "bazaar_traits.hpp"
+#include "constexpr_arrays.hpp"
+
+namespace bazaar::traits
+{
+    //-------------------------------------------------------------------------------------------
+    // Batch evaluation of traits
+    //-------------------------------------------------------------------------------------------
+
+    // Trait mask: bit I is the value of the I-th trait applied to Tp, so a set of questions about a type
+    // is answered by a single integral constant which runtime code can switch on. The mask does not spare the
+    // compiler any work: every Traits<Tp> is still instantiated, and the mask is one more class on top of them.
+    namespace impl
+    {
+        template<template<typename> typename, template<typename> typename>
+        struct is_same_trait : public false_type {};
+
+        template<template<typename> typename Trait>
+        struct is_same_trait<Trait, Trait> : public true_type {};
+
+        // The leading element keeps the array non empty when no trait is given.
+        template<std::size_t N>
+        constexpr std::uint64_t make_trait_mask(const bool (&values)[N]) noexcept {
+            std::uint64_t mask{0};
+            for (std::size_t i{1}; i < N; ++i) {
+                mask |= std::uint64_t{values[i]} << (i - 1);
+            }
+            return mask;
+        }
+    }
+
+    template<typename Tp, template<typename> typename ... Traits>
+    struct trait_mask : public integral_constant<std::uint64_t,
+            impl::make_trait_mask<sizeof...(Traits) + 1>({false, bool(Traits<Tp>::value)...})>
+    {
+        static_assert(sizeof...(Traits) <= 64, "bzt::trait_mask holds at most 64 traits");
+
+        static constexpr std::size_t size() noexcept {return sizeof...(Traits);}
+
+        // Position of Trait in the mask, size() when it is not part of it.
+        template<template<typename> typename Trait>
+        static constexpr std::size_t index_of() noexcept {
+            return impl::find_first_true<sizeof...(Traits) + 1>({false, impl::is_same_trait<Trait, Traits>::value...});
+        }
+
+        // Bit of Trait, to test or build masks at runtime.
+        template<template<typename> typename Trait>
+        static constexpr std::uint64_t bit() noexcept {
+            static_assert(index_of<Trait>() < size(), "Trait is not part of the bzt::trait_mask");
+            return std::uint64_t{1} << index_of<Trait>();
+        }
+
+        template<template<typename> typename Trait>
+        static constexpr bool has() noexcept {return (trait_mask::value & bit<Trait>()) != 0;}
+
+        static constexpr bool test(std::size_t index) noexcept {
+            return index < size() && ((trait_mask::value >> index) & std::uint64_t{1}) != 0;
+        }
+
+        static constexpr std::size_t count() noexcept {
+            std::size_t count{0};
+            for (auto mask{trait_mask::value}; mask != 0; mask &= mask - 1) ++count;
+            return count;
+        }
+
+        static constexpr bool all() noexcept {return count() == size();}
+        static constexpr bool any() noexcept {return trait_mask::value != 0;}
+        static constexpr bool none() noexcept {return trait_mask::value == 0;}
+    };
+
+    template<typename Tp, template<typename> typename ... Traits>
+    [[maybe_unused]] inline constexpr auto trait_mask_v{trait_mask<Tp, Traits...>::value};
+}
+
+#endif //BAZAAR_TRAIT_MASK_HPP
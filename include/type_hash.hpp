@@ -0,0 +1,77 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_TYPE_HASH_HPP
+#define BAZAAR_TYPE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "fnv1a_hash.hpp"
+#include "integral_constant.hpp"
+
+namespace bazaar::traits
+{
+    //-------------------------------------------------------------------------------------------
+    // Type identification without RTTI
+    //-------------------------------------------------------------------------------------------
+
+    // Type name, the name of the type as the compiler prints it in the signature of a function template. The name is
+    // the same in every translation unit and every build made with the same compiler, but differs between compilers
+    // (GCC prints "unsigned int" where MSVC would not) and is not guaranteed to be unique: types which are printed the
+    // same, such as two lambdas or two classes of anonymous namespaces in different translation units, share it.
+    namespace impl
+    {
+        template<typename Tp>
+        constexpr const char *type_signature() noexcept {
+            return __PRETTY_FUNCTION__;
+        }
+
+        // GCC prints "... [with Tp = int]" and Clang "... [Tp = int]". The name starts after the first "Tp = ", which
+        // belongs to the function itself, and ends before the last ']'.
+        constexpr std::string_view name_in_signature(const std::string_view signature) noexcept {
+            constexpr std::string_view marker{"Tp = "};
+            const auto begin{signature.find(marker) + marker.size()};
+            const auto end{signature.rfind(']')};
+            return signature.substr(begin, end - begin);
+        }
+    }
+
+    template<typename Tp>
+    struct type_name {
+        static constexpr std::string_view value{impl::name_in_signature(impl::type_signature<Tp>())};
+        using value_type = std::string_view;
+        constexpr explicit operator value_type () const noexcept {return value;}
+        constexpr value_type operator()() const noexcept{return value;}
+    };
+
+    template<typename Tp>
+    [[maybe_unused]] inline constexpr auto type_name_v{type_name<Tp>::value};
+
+    // Type hash, the 64 bits FNV-1a hash of the type name. Being an integral constant, it can key flat hash maps as
+    // well as case labels, and it collides where the names do.
+    template<typename Tp>
+    struct type_hash : public integral_constant<std::uint64_t,
+            impl::fnv1a(type_name<Tp>::value.data(), type_name<Tp>::value.size())> {};
+
+    template<typename Tp>
+    [[maybe_unused]] inline constexpr auto type_hash_v{type_hash<Tp>::value};
+}
+
+#endif //BAZAAR_TYPE_HASH_HPP
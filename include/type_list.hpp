@@ -21,57 +21,756 @@
 #define BAZAAR_TYPE_LIST_HPP
 
 #include <cstddef>
+#include "cons_list.hpp"
+#include "constexpr_arrays.hpp"
+#include "fnv1a_hash.hpp"
+#include "helper_traits.hpp"
+#include "macros.hpp"
+#include "sequence_generator.hpp"
 
 namespace bazaar::traits {
 
-    namespace impl {
-        struct end_of_list
-        {
-            end_of_list() = delete;
-            end_of_list(const end_of_list&) = delete;
-            end_of_list& operator=(const end_of_list&) = delete;
-            ~end_of_list() = delete;
+    //-------------------------------------------------------------------------------------------
+    // Variadic type list
+    //-------------------------------------------------------------------------------------------
+
+    template<typename ... Tp>
+    struct type_list {
+        using type = type_list;
+        static constexpr std::size_t size() noexcept {return sizeof ...(Tp);}
+    };
+
+    // Size
+    template<typename List> struct type_list_size;
+
+    template<typename ... Tp>
+    struct type_list_size<type_list<Tp...>> : public integral_constant<std::size_t, sizeof ...(Tp)> {};
+
+    template<typename List>
+    [[maybe_unused]] inline constexpr auto type_list_size_v{type_list_size<List>::value};
+
+    // At
+    namespace impl
+    {
+#if BZT_HAS_BUILTIN(__type_pack_element)
+        template<std::size_t Index, typename ... Tp>
+        struct type_pack_element : public identity<__type_pack_element<Index, Tp...>> {};
+#else
+        // The Index first elements are swallowed by as many void pointer parameters, the next one is deduced. Cheaper
+        // for GCC than overload resolution among Index tagged bases, which costs a class with as many bases as the list.
+        template<std::size_t, typename>
+        using skipped_element = const volatile void *;
+
+        template<typename Skipped>
+        struct element_selector;
+
+        template<std::size_t ... Skipped>
+        struct element_selector<integer_sequence<std::size_t, Skipped...>> {
+            template<typename Tp>
+            static identity<Tp> select(skipped_element<Skipped, Tp>..., identity<Tp> *, ...);
+        };
+
+        template<std::size_t Index, typename ... Tp>
+        struct type_pack_element : public decltype(element_selector<index_sequence_of<Index>>
+                ::select(static_cast<identity<Tp> *>(nullptr)...)) {};
+#endif
+    }
+
+    template<typename List, std::size_t Index> struct type_list_at;
+
+    template<typename ... Tp, std::size_t Index>
+    struct type_list_at<type_list<Tp...>, Index> : public impl::type_pack_element<Index, Tp...> {
+        static_assert(Index < sizeof ...(Tp), "bzt::type_list_at index out of range");
+    };
+
+    template<typename List, std::size_t Index>
+    using type_list_at_t [[maybe_unused]] = typename type_list_at<List, Index>::type;
+
+    template<typename List>
+    using type_list_front_t [[maybe_unused]] = typename type_list_at<List, 0>::type;
+
+    template<typename List>
+    using type_list_back_t [[maybe_unused]] = typename type_list_at<List, type_list_size_v<List> - 1>::type;
+
+
+    // Index of, the size of the list when the type is not part of it
+    template<typename List, typename Up> struct type_list_index_of;
+
+    template<typename ... Tp, typename Up>
+    struct type_list_index_of<type_list<Tp...>, Up> : public integral_constant<std::size_t,
+#if BZT_HAS_BUILTIN(__is_same)
+            impl::find_first_true<sizeof ...(Tp) + 1>({false, __is_same(Up, Tp)...})> {};
+#else
+            impl::find_first_true<sizeof ...(Tp) + 1>({false, is_same_v<Up, Tp>...})> {};
+#endif
+
+    template<typename List, typename Up>
+    [[maybe_unused]] inline constexpr auto type_list_index_of_v{type_list_index_of<List, Up>::value};
+
+    // Contains
+    template<typename List, typename Up>
+    struct type_list_contains : public bool_constant<(type_list_index_of_v<List, Up> < type_list_size_v<List>)> {};
+
+    template<typename List, typename Up>
+    [[maybe_unused]] inline constexpr auto type_list_contains_v{type_list_contains<List, Up>::value};
+
+    // Conversions from and to the nested type_list_t lists (signed_types_list...)
+    namespace impl
+    {
+        template<typename ConsList, typename ... Tp>
+        struct from_cons_list : public identity<type_list<Tp...>> {};
+
+        template<typename Head, typename Next, typename ... Tp>
+        struct from_cons_list<type_list_t<Head, Next>, Tp...> : public from_cons_list<Next, Tp..., Head> {};
+
+        template<typename ... Tp>
+        struct to_cons_list : public identity<end_of_list> {};
+
+        template<typename Head, typename ... Tail>
+        struct to_cons_list<Head, Tail...> : public identity<type_list_t<Head, typename to_cons_list<Tail...>::type>> {};
+    }
+
+    template<typename ConsList>
+    struct type_list_from_cons : public impl::from_cons_list<ConsList> {};
+
+    template<typename ConsList>
+    using type_list_from_cons_t [[maybe_unused]] = typename type_list_from_cons<ConsList>::type;
+
+    template<typename List> struct type_list_to_cons;
+
+    template<typename ... Tp>
+    struct type_list_to_cons<type_list<Tp...>> : public impl::to_cons_list<Tp...> {};
+
+    template<typename List>
+    using type_list_to_cons_t [[maybe_unused]] = typename type_list_to_cons<List>::type;
+
+    // Selection of the elements of a pack flagged by a mask, without recursion: the positions of the kept elements
+    // are computed by a constexpr function and the elements are then picked at these positions.
+    namespace impl
+    {
+#if BZT_HAS_BUILTIN(__type_pack_element)
+        template<typename ... Tp>
+        struct element_table {
+            template<std::size_t Index>
+            using at = __type_pack_element<Index, Tp...>;
+        };
+#else
+        // Picking many elements one by one with type_pack_element would swallow a different number of elements each
+        // time, the elements are rather made bases tagged with their index once and each one is found by deduction.
+        template<std::size_t Index, typename Tp>
+        struct indexed_element : public identity<Tp> {};
+
+        template<typename Indexes, typename ... Tp>
+        struct indexed_elements;
+
+        template<std::size_t ... Indexes, typename ... Tp>
+        struct indexed_elements<integer_sequence<std::size_t, Indexes...>, Tp...> :
+                public indexed_element<Indexes, Tp>... {};
+
+        template<std::size_t Index, typename Tp>
+        identity<Tp> select_indexed_element(const indexed_element<Index, Tp> *);
+
+        template<typename ... Tp>
+        struct element_table {
+            template<std::size_t Index>
+            using at = typename decltype(select_indexed_element<Index>(
+                    static_cast<indexed_elements<index_sequence_of<sizeof ...(Tp)>, Tp...> *>(nullptr)))::type;
+        };
+#endif
+
+        // The elements of a table at the positions held by a static array. The array is given by reference and the
+        // table as a single type: GCC substitutes again whatever names the whole pack, or a member of a class
+        // specialized over it, for each element of an expansion, which makes a selection quadratic.
+        template<template<typename ...> typename List, typename Table, const auto &Positions, typename Indexes>
+        struct select_positions;
+
+        template<template<typename ...> typename List, typename Table, const auto &Positions, std::size_t ... Indexes>
+        struct select_positions<List, Table, Positions, integer_sequence<std::size_t, Indexes...>> :
+                public identity<List<typename Table::template at<Positions.value[Indexes]>...>> {};
+
+        template<template<typename ...> typename List, bool ... Keep>
+        struct select_kept {
+            static constexpr auto positions{make_kept_positions<sizeof ...(Keep)>({false, Keep...})};
+
+            template<typename ... Tp>
+            using apply = typename select_positions<List, element_table<Tp...>, positions,
+                    index_sequence_of<positions.size>>::type;
+        };
+    }
+
+    // Concatenation of many type lists. Peeling the lists one by one would take one instantiation, and one copy of
+    // the remaining lists, per list, while a single fold expression copies the growing result at each list: they are
+    // rather merged by groups of 16, and the groups again until a single group is left, so that the depth is the
+    // number of lists divided by 16.
+    namespace impl
+    {
+        template<typename List>
+        struct concatenated : public identity<List> {};
+
+        template<typename ... Tp, typename ... Up>
+        concatenated<type_list<Tp..., Up...>> operator+(concatenated<type_list<Tp...>>, concatenated<type_list<Up...>>);
+
+        // A few lists are merged by a fold expression, which does not instantiate a template per list.
+        template<typename ... Lists>
+        struct concat_few : public decltype((concatenated<type_list<>>{} + ... + concatenated<Lists>{})) {};
+
+        template<typename Groups, typename ... Lists>
+        struct concat_groups;
+
+        template<typename ... Groups, typename ... Lists>
+        struct concat_groups<type_list<Groups...>, Lists...> :
+                public identity<type_list<Groups..., typename concat_few<Lists...>::type>> {};
+
+        template<typename ... Groups,
+                typename ... Tp0, typename ... Tp1, typename ... Tp2, typename ... Tp3,
+                typename ... Tp4, typename ... Tp5, typename ... Tp6, typename ... Tp7,
+                typename ... Tp8, typename ... Tp9, typename ... Tp10, typename ... Tp11,
+                typename ... Tp12, typename ... Tp13, typename ... Tp14, typename ... Tp15, typename ... Lists>
+        struct concat_groups<type_list<Groups...>,
+                type_list<Tp0...>, type_list<Tp1...>, type_list<Tp2...>, type_list<Tp3...>,
+                type_list<Tp4...>, type_list<Tp5...>, type_list<Tp6...>, type_list<Tp7...>,
+                type_list<Tp8...>, type_list<Tp9...>, type_list<Tp10...>, type_list<Tp11...>,
+                type_list<Tp12...>, type_list<Tp13...>, type_list<Tp14...>, type_list<Tp15...>, Lists...> :
+                public concat_groups<type_list<Groups..., type_list<
+                        Tp0..., Tp1..., Tp2..., Tp3..., Tp4..., Tp5..., Tp6..., Tp7...,
+                        Tp8..., Tp9..., Tp10..., Tp11..., Tp12..., Tp13..., Tp14..., Tp15...>>, Lists...> {};
+
+        template<bool Few, typename ... Lists>
+        struct concat_lists : public concat_few<Lists...> {};
+
+        template<typename Groups>
+        struct concat_grouped;
+
+        template<typename ... Groups>
+        struct concat_grouped<type_list<Groups...>> : public concat_lists<(sizeof ...(Groups) <= 16), Groups...> {};
+
+        template<typename ... Lists>
+        struct concat_lists<false, Lists...> :
+                public concat_grouped<typename concat_groups<type_list<>, Lists...>::type> {};
+
+        template<typename ... Lists>
+        using concat_t = typename concat_lists<(sizeof ...(Lists) <= 16), Lists...>::type;
+    }
+
+    //-------------------------------------------------------------------------------------------
+    // Type set
+    //-------------------------------------------------------------------------------------------
+
+    template<typename ... Tp>
+    struct type_set {
+        using type = type_set;
+        static constexpr std::size_t size() noexcept {return sizeof ...(Tp);}
+    };
+
+    // Contains
+    template<typename Set, typename Up> struct type_set_contains;
+
+    template<typename ... Tp, typename Up>
+    struct type_set_contains<type_set<Tp...>, Up> : public impl::is_one_of<Up, Tp...>::type {};
+
+    template<typename Set, typename Up>
+    [[maybe_unused]] inline constexpr auto type_set_contains_v{type_set_contains<Set, Up>::value};
+
+    // Insert
+    template<typename Set, typename Up> struct type_set_insert;
+
+    template<typename ... Tp, typename Up>
+    struct type_set_insert<type_set<Tp...>, Up> : public
+            conditional<type_set_contains_v<type_set<Tp...>, Up>, type_set<Tp...>, type_set<Tp..., Up>> {};
+
+    template<typename Set, typename Up>
+    using type_set_insert_t [[maybe_unused]] = typename type_set_insert<Set, Up>::type;
+
+    // Union, the elements of the second set missing from the first one are appended to it
+    namespace impl
+    {
+        template<typename ... Tp>
+        struct append_to_type_set {
+            template<typename ... Up>
+            using apply = type_set<Tp..., Up...>;
+        };
+    }
+
+    template<typename Set1, typename Set2> struct type_set_union;
+
+    template<typename ... Tp, typename ... Up>
+    struct type_set_union<type_set<Tp...>, type_set<Up...>> : public identity<
+            typename impl::select_kept<impl::append_to_type_set<Tp...>::template apply,
+                    !type_set_contains_v<type_set<Tp...>, Up>...>::template apply<Up...>> {};
+
+    template<typename Set1, typename Set2>
+    using type_set_union_t [[maybe_unused]] = typename type_set_union<Set1, Set2>::type;
+
+    // Intersection, in the order of the first set
+    template<typename Set1, typename Set2> struct type_set_intersection;
+
+    template<typename ... Tp, typename ... Up>
+    struct type_set_intersection<type_set<Tp...>, type_set<Up...>> : public identity<
+            typename impl::select_kept<type_set, type_set_contains_v<type_set<Up...>, Tp>...>::template apply<Tp...>> {};
+
+    template<typename Set1, typename Set2>
+    using type_set_intersection_t [[maybe_unused]] = typename type_set_intersection<Set1, Set2>::type;
+
+    //-------------------------------------------------------------------------------------------
+    // Type map
+    //-------------------------------------------------------------------------------------------
+
+    template<typename Key, typename Value>
+    struct type_pair {
+        using first_type = Key;
+        using second_type = Value;
+    };
+
+    template<typename ... Pairs>
+    struct type_map;
+
+    // The lookups deduce the value from the only base holding the key, a key repeated in the map would make them
+    // silently fail. The keys are rather checked by making them the bases of a class: a repeated key is a duplicate
+    // base, an error naming it, at the cost of a single class where type_list_unique would hash every key. The map is
+    // seldom instantiated as a complete type, so each operation over it checks its keys as well.
+    namespace impl
+    {
+        template<typename Key>
+        struct type_map_key {};
+
+        template<typename ... Keys>
+        struct type_map_unique_keys : public type_map_key<Keys>... {
+            static constexpr bool value{true};
+        };
+    }
+
+    template<typename ... Keys, typename ... Values>
+    struct type_map<type_pair<Keys, Values>...> {
+        static_assert(impl::type_map_unique_keys<Keys...>::value, "bzt::type_map requires unique keys");
+        using type = type_map;
+        static constexpr std::size_t size() noexcept {return sizeof ...(Keys);}
+    };
+
+    // At: the pairs are bases of a single class, the value of a key is deduced from the only base holding it.
+    namespace impl
+    {
+        template<typename ... Pairs>
+        struct type_map_entries : public Pairs... {};
+
+        template<typename Key, typename Value>
+        identity<Value> type_map_lookup(const type_pair<Key, Value> *);
+
+        template<typename Map, typename Key, typename = void>
+        struct type_map_at_impl {};
+
+        template<typename ... Pairs, typename Key>
+        struct type_map_at_impl<type_map<Pairs...>, Key,
+                void_t<decltype(type_map_lookup<Key>(static_cast<type_map_entries<Pairs...> *>(nullptr)))>> :
+                public decltype(type_map_lookup<Key>(static_cast<type_map_entries<Pairs...> *>(nullptr))) {};
+    }
+
+    // Has no type member when the key is not in the map.
+    template<typename Map, typename Key>
+    struct type_map_at : public impl::type_map_at_impl<Map, Key> {};
+
+    template<typename ... Keys, typename ... Values, typename Key>
+    struct type_map_at<type_map<type_pair<Keys, Values>...>, Key> :
+            public impl::type_map_at_impl<type_map<type_pair<Keys, Values>...>, Key> {
+        static_assert(impl::type_map_unique_keys<Keys...>::value, "bzt::type_map requires unique keys");
+    };
+
+    template<typename Map, typename Key>
+    using type_map_at_t [[maybe_unused]] = typename type_map_at<Map, Key>::type;
+
+    // Contains, through type_map_at which checks the keys
+    namespace impl
+    {
+        template<typename Map, typename Key, typename = void>
+        struct type_map_contains_impl : public false_type {};
+
+        template<typename Map, typename Key>
+        struct type_map_contains_impl<Map, Key, void_t<typename type_map_at<Map, Key>::type>> : public true_type {};
+    }
+
+    template<typename Map, typename Key>
+    struct type_map_contains : public impl::type_map_contains_impl<Map, Key> {};
+
+    template<typename Map, typename Key>
+    [[maybe_unused]] inline constexpr auto type_map_contains_v{type_map_contains<Map, Key>::value};
+
+    // Insert or assign, an existing key keeps its position
+    template<typename Map, typename Key, typename Value> struct type_map_insert_or_assign;
+
+    template<typename ... Keys, typename ... Values, typename Key, typename Value>
+    struct type_map_insert_or_assign<type_map<type_pair<Keys, Values>...>, Key, Value> : public conditional<
+            type_map_contains_v<type_map<type_pair<Keys, Values>...>, Key>,
+            type_map<conditional_t<is_same_v<Keys, Key>, type_pair<Key, Value>, type_pair<Keys, Values>>...>,
+            type_map<type_pair<Keys, Values>..., type_pair<Key, Value>>> {
+        static_assert(impl::type_map_unique_keys<Keys...>::value, "bzt::type_map requires unique keys");
+    };
+
+    template<typename Map, typename Key, typename Value>
+    using type_map_insert_or_assign_t [[maybe_unused]] =
+            typename type_map_insert_or_assign<Map, Key, Value>::type;
+
+    // Keys and values
+    template<typename Map> struct type_map_keys;
+
+    template<typename ... Keys, typename ... Values>
+    struct type_map_keys<type_map<type_pair<Keys, Values>...>> : public identity<type_list<Keys...>> {
+        static_assert(impl::type_map_unique_keys<Keys...>::value, "bzt::type_map requires unique keys");
+    };
+
+    template<typename Map>
+    using type_map_keys_t [[maybe_unused]] = typename type_map_keys<Map>::type;
+
+    template<typename Map> struct type_map_values;
+
+    template<typename ... Keys, typename ... Values>
+    struct type_map_values<type_map<type_pair<Keys, Values>...>> : public identity<type_list<Values...>> {
+        static_assert(impl::type_map_unique_keys<Keys...>::value, "bzt::type_map requires unique keys");
+    };
+
+    template<typename Map>
+    using type_map_values_t [[maybe_unused]] = typename type_map_values<Map>::type;
+
+    //-------------------------------------------------------------------------------------------
+    // Sort
+    //-------------------------------------------------------------------------------------------
+
+    namespace impl
+    {
+        struct layout_key {
+            std::size_t alignment;
+            std::size_t size;
         };
-        template<typename Hd, typename Nt>
-        struct type_list_impl {
-            using Head [[maybe_unused]] = Hd;
-            using Next [[maybe_unused]] = Nt;
+
+        constexpr bool is_stricter_layout(const layout_key &lhs, const layout_key &rhs) noexcept {
+            return lhs.alignment > rhs.alignment || (lhs.alignment == rhs.alignment && lhs.size > rhs.size);
+        }
+    }
+
+    // Sort by alignment: the types by decreasing alignment then size, equal ones keeping their order, which is the
+    // declaration order minimizing the padding of a structure. permutation holds the original index of each sorted
+    // element, inverse_permutation the sorted index of each original element.
+    template<typename List> struct type_list_sort_by_alignment;
+
+    template<typename ... Tp>
+    struct type_list_sort_by_alignment<type_list<Tp...>> {
+    private:
+        static constexpr impl::layout_key keys[]{{0, 0}, {alignof(Tp), sizeof(Tp)}...};
+        static constexpr auto order{impl::stable_sort_positions<sizeof ...(Tp)>(keys, impl::is_stricter_layout)};
+        static constexpr auto inverse{impl::inverse_positions<sizeof ...(Tp)>(order)};
+
+        using indexes = impl::index_sequence_of<sizeof ...(Tp)>;
+    public:
+        using type = typename impl::select_positions<type_list, impl::element_table<Tp...>, order, indexes>::type;
+        using permutation = typename impl::positions_sequence<std::size_t, order, indexes>::type;
+        using inverse_permutation = typename impl::positions_sequence<std::size_t, inverse, indexes>::type;
+    };
+
+    template<typename List>
+    using type_list_sort_by_alignment_t [[maybe_unused]] = typename type_list_sort_by_alignment<List>::type;
+
+    //-------------------------------------------------------------------------------------------
+    // Algorithms
+    //-------------------------------------------------------------------------------------------
+
+    // The predicates are evaluated in one expansion, their results are reduced by constexpr functions or each element
+    // is mapped to a list of zero or one element and the lists concatenated, so that none of these algorithms
+    // recurses over the elements of the list.
+
+    // Transform, F being a trait with a type member (add_pointer, decay...)
+    template<typename List, template<typename> typename F> struct type_list_transform;
+
+    template<typename ... Tp, template<typename> typename F>
+    struct type_list_transform<type_list<Tp...>, F> : public identity<type_list<typename F<Tp>::type...>> {};
+
+    template<typename List, template<typename> typename F>
+    using type_list_transform_t [[maybe_unused]] = typename type_list_transform<List, F>::type;
+
+    // Filter, the elements satisfying Pred in their order
+    template<typename List, template<typename> typename Pred> struct type_list_filter;
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_filter<type_list<Tp...>, Pred> : public
+            identity<impl::concat_t<conditional_t<Pred<Tp>::value, type_list<Tp>, type_list<>>...>> {};
+
+    template<typename List, template<typename> typename Pred>
+    using type_list_filter_t [[maybe_unused]] = typename type_list_filter<List, Pred>::type;
+
+    // Remove if, the elements not satisfying Pred in their order
+    template<typename List, template<typename> typename Pred> struct type_list_remove_if;
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_remove_if<type_list<Tp...>, Pred> : public
+            identity<impl::concat_t<conditional_t<Pred<Tp>::value, type_list<>, type_list<Tp>>...>> {};
+
+    template<typename List, template<typename> typename Pred>
+    using type_list_remove_if_t [[maybe_unused]] = typename type_list_remove_if<List, Pred>::type;
+
+    // Partition, a type_pair of the elements satisfying Pred and of the others, both in their order
+    template<typename List, template<typename> typename Pred>
+    struct type_list_partition : public
+            identity<type_pair<type_list_filter_t<List, Pred>, type_list_remove_if_t<List, Pred>>> {};
+
+    template<typename List, template<typename> typename Pred>
+    using type_list_partition_t [[maybe_unused]] = typename type_list_partition<List, Pred>::type;
+
+    // Count if
+    template<typename List, template<typename> typename Pred> struct type_list_count_if;
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_count_if<type_list<Tp...>, Pred> : public integral_constant<std::size_t,
+            impl::count_true<sizeof ...(Tp) + 1>({false, Pred<Tp>::value...})> {};
+
+    template<typename List, template<typename> typename Pred>
+    [[maybe_unused]] inline constexpr auto type_list_count_if_v{type_list_count_if<List, Pred>::value};
+
+    // All of, any of and none of. Unlike conjunction and disjunction, Pred is instantiated for every element.
+    template<typename List, template<typename> typename Pred>
+    struct type_list_all_of : public bool_constant<type_list_count_if_v<List, Pred> == type_list_size_v<List>> {};
+
+    template<typename List, template<typename> typename Pred>
+    [[maybe_unused]] inline constexpr auto type_list_all_of_v{type_list_all_of<List, Pred>::value};
+
+    template<typename List, template<typename> typename Pred>
+    struct type_list_any_of : public bool_constant<(type_list_count_if_v<List, Pred> > 0)> {};
+
+    template<typename List, template<typename> typename Pred>
+    [[maybe_unused]] inline constexpr auto type_list_any_of_v{type_list_any_of<List, Pred>::value};
+
+    template<typename List, template<typename> typename Pred>
+    struct type_list_none_of : public bool_constant<type_list_count_if_v<List, Pred> == 0> {};
+
+    template<typename List, template<typename> typename Pred>
+    [[maybe_unused]] inline constexpr auto type_list_none_of_v{type_list_none_of<List, Pred>::value};
+
+    // Index of if and find if, the first element satisfying Pred. As with disjunction, Pred is not instantiated for
+    // the elements after the first match, which matters for the predicates costly to evaluate. The elements are
+    // rather tested by chunks of 16, the next chunk being visited only when none of the current chunk matches, so the
+    // depth is the number of elements divided by 16 instead of the number of elements. Each step still copies the
+    // remaining elements, which makes a walk over the whole list quadratic, like the concatenation of many lists.
+    // The Skip first matches are passed over, which also gives the filter view its elements. The value of a chunk is
+    // the index of the match, or the end of the chunk with the matches still to pass over.
+    namespace impl
+    {
+        template<std::size_t Index, std::size_t Skip, template<typename> typename Pred, typename ... Tp>
+        struct nth_index_of_if_in_chunk : public integral_constant<std::size_t, Index> {
+            static constexpr std::size_t skip{Skip};
         };
+
+        template<std::size_t Index, std::size_t Skip, template<typename> typename Pred, typename T0, typename ... Tp>
+        struct nth_index_of_if_in_chunk<Index, Skip, Pred, T0, Tp...> : public
+                conditional_t<Pred<T0>::value && Skip == 0, nth_index_of_if_in_chunk<Index, 0, Pred>,
+                nth_index_of_if_in_chunk<Index + 1, Skip - Pred<T0>::value, Pred, Tp...>> {};
+
+        template<std::size_t Index, std::size_t Skip, template<typename> typename Pred, typename ... Tp>
+        struct nth_index_of_if : public nth_index_of_if_in_chunk<Index, Skip, Pred, Tp...> {};
+
+        template<std::size_t Index, std::size_t Skip, template<typename> typename Pred,
+                typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7,
+                typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14,
+                typename T15, typename ... Tp>
+        struct nth_index_of_if<Index, Skip, Pred,
+                T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, Tp...> {
+        private:
+            using chunk = nth_index_of_if_in_chunk<Index, Skip, Pred,
+                    T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>;
+        public:
+            static constexpr std::size_t value{conditional_t<(chunk::value < Index + 16), chunk,
+                    nth_index_of_if<Index + 16, chunk::skip, Pred, Tp...>>::value};
+        };
+
+        template<bool Found, std::size_t Index, typename ... Tp>
+        struct element_if_found {};
+
+        template<std::size_t Index, typename ... Tp>
+        struct element_if_found<true, Index, Tp...> : public type_pack_element<Index, Tp...> {};
     }
 
-    template<typename Head, typename Next>
-    using type_list_t = impl::type_list_impl<Head, Next>;
+    // The size of the list when no element satisfies Pred
+    template<typename List, template<typename> typename Pred> struct type_list_index_of_if;
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_index_of_if<type_list<Tp...>, Pred> : public
+            integral_constant<std::size_t, impl::nth_index_of_if<0, 0, Pred, Tp...>::value> {};
+
+    template<typename List, template<typename> typename Pred>
+    [[maybe_unused]] inline constexpr auto type_list_index_of_if_v{type_list_index_of_if<List, Pred>::value};
 
-    using signed_types_list = type_list_t<signed char,
-            type_list_t<signed short,
-                    type_list_t<signed int,
-                            type_list_t<signed long,
-                                    type_list_t<signed long long,
-                                            impl::end_of_list>>>>>;
+    // No type member when no element satisfies Pred
+    template<typename List, template<typename> typename Pred> struct type_list_find_if;
 
-    using unsigned_types_list = type_list_t<unsigned char,
-            type_list_t<unsigned short,
-                    type_list_t<unsigned int,
-                            type_list_t<unsigned long,
-                                    type_list_t<unsigned long long,
-                                            impl::end_of_list>>>>>;
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_find_if<type_list<Tp...>, Pred> : public impl::element_if_found<
+            (type_list_index_of_if_v<type_list<Tp...>, Pred> < sizeof ...(Tp)),
+            type_list_index_of_if_v<type_list<Tp...>, Pred>, Tp...> {};
 
+    template<typename List, template<typename> typename Pred>
+    using type_list_find_if_t [[maybe_unused]] = typename type_list_find_if<List, Pred>::type;
+
+    // Views, lists whose elements are only computed when accessed through type_list_at, type_list_front_t or
+    // type_list_back_t: picking one element of a transform view instantiates F once instead of once per element, and
+    // the I-th element of a filter view evaluates Pred up to it only. The size of a filter view evaluates Pred for every
+    // element. A view is made a list by type_list_transform or type_list_filter over the same arguments.
+    template<typename List, template<typename> typename F> struct type_list_transform_view;
+
+    template<typename ... Tp, template<typename> typename F>
+    struct type_list_transform_view<type_list<Tp...>, F> {};
+
+    template<typename ... Tp, template<typename> typename F>
+    struct type_list_size<type_list_transform_view<type_list<Tp...>, F>> :
+            public integral_constant<std::size_t, sizeof ...(Tp)> {};
+
+    template<typename ... Tp, template<typename> typename F, std::size_t Index>
+    struct type_list_at<type_list_transform_view<type_list<Tp...>, F>, Index> :
+            public identity<typename F<typename impl::type_pack_element<Index, Tp...>::type>::type> {
+        static_assert(Index < sizeof ...(Tp), "bzt::type_list_at index out of range");
+    };
+
+    template<typename List, template<typename> typename Pred> struct type_list_filter_view;
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_filter_view<type_list<Tp...>, Pred> {};
+
+    template<typename ... Tp, template<typename> typename Pred>
+    struct type_list_size<type_list_filter_view<type_list<Tp...>, Pred>> :
+            public type_list_count_if<type_list<Tp...>, Pred> {};
+
+    template<typename ... Tp, template<typename> typename Pred, std::size_t Index>
+    struct type_list_at<type_list_filter_view<type_list<Tp...>, Pred>, Index> : public impl::element_if_found<
+            (impl::nth_index_of_if<0, Index, Pred, Tp...>::value < sizeof ...(Tp)),
+            impl::nth_index_of_if<0, Index, Pred, Tp...>::value, Tp...> {
+        static_assert(impl::nth_index_of_if<0, Index, Pred, Tp...>::value < sizeof ...(Tp),
+                      "bzt::type_list_at index out of range");
+    };
+
+    // Unique, the first occurrence of each element in their order. Telling whether an element was seen before by a
+    // membership in the elements before it costs, with GCC, a walk over as many bases as there are such elements. Each
+    // element is rather given a key, the hash of a signature naming it and the address of the variable holding the
+    // hash, and the first occurrences are found by a constexpr function inserting the keys in a hash table. The hash is
+    // taken over the signature rather than through type_hash, which would bring <string_view> in.
     namespace impl
     {
-        template<typename TypeList, std::size_t Size, bool = Size <= sizeof(typename TypeList::Head)>
-        struct find_first_upper_bound_element_by_size {};
+        template<typename Tp>
+        constexpr unsigned long long type_name_hash() noexcept {
+            return fnv1a(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+        }
 
-        template<typename Head, typename Next, std::size_t Size>
-        struct find_first_upper_bound_element_by_size<type_list_t<Head, Next>, Size, true>{
-            using type = Head;
+        template<typename Tp>
+        inline constexpr unsigned long long type_name_hash_v{type_name_hash<Tp>()};
+
+        struct type_key {
+            unsigned long long hash;
+            const void *address;
         };
 
-        template<typename Head, typename Next, std::size_t Size>
-        struct find_first_upper_bound_element_by_size<type_list_t<Head, Next>, Size, false> {
-            using type = typename find_first_upper_bound_element_by_size<Next, Size>::type;
+        template<std::size_t N>
+        struct flags_array {
+            bool value[N + 1];
         };
+
+        // Open addressing over twice as many buckets as keys. The unused leading element of the keys array lets 0
+        // mark the empty buckets.
+        template<std::size_t N>
+        constexpr flags_array<N> first_occurrences(const type_key (&keys)[N + 1]) noexcept {
+            constexpr std::size_t buckets{2 * N + 1};
+            type_key local[N + 1]{};
+            for (std::size_t i{0}; i <= N; ++i) local[i] = keys[i];
+            std::size_t table[buckets]{};
+            flags_array<N> first{};
+            for (std::size_t i{1}; i <= N; ++i) {
+                auto bucket{local[i].hash % buckets};
+                first.value[i] = true;
+                for (; table[bucket] != 0; bucket = bucket + 1 < buckets ? bucket + 1 : 0) {
+                    const auto &seen{local[table[bucket]]};
+                    if (seen.hash == local[i].hash && seen.address == local[i].address) {
+                        first.value[i] = false;
+                        break;
+                    }
+                }
+                if (first.value[i]) table[bucket] = i;
+            }
+            return first;
+        }
+
+        // The flags are given by reference and the elements as a single list, for the same reason as select_positions.
+        template<const auto &Flags, typename Indexes, typename List>
+        struct select_flagged;
+
+        template<const auto &Flags, std::size_t ... Indexes, typename ... Tp>
+        struct select_flagged<Flags, integer_sequence<std::size_t, Indexes...>, type_list<Tp...>> :
+                public identity<concat_t<conditional_t<Flags.value[Indexes + 1], type_list<Tp>, type_list<>>...>> {};
+    }
+
+    template<typename List> struct type_list_unique;
+
+    template<typename ... Tp>
+    struct type_list_unique<type_list<Tp...>> {
+    private:
+        static constexpr auto first{impl::first_occurrences<sizeof ...(Tp)>(
+                {{0, nullptr}, {impl::type_name_hash_v<Tp>, &impl::type_name_hash_v<Tp>}...})};
+    public:
+        using type = typename impl::select_flagged<first, impl::index_sequence_of<sizeof ...(Tp)>,
+                type_list<Tp...>>::type;
+    };
+
+    template<typename List>
+    using type_list_unique_t [[maybe_unused]] = typename type_list_unique<List>::type;
+
+    // Concat, a single fold expression for up to 16 lists
+    template<typename ... Lists>
+    struct type_list_concat : public identity<impl::concat_t<Lists...>> {};
+
+    template<typename ... Lists>
+    using type_list_concat_t [[maybe_unused]] = typename type_list_concat<Lists...>::type;
+
+    // Flatten, the elements of the nested type lists in their place, whatever their depth
+    namespace impl
+    {
+        template<typename Tp>
+        struct flattened : public identity<type_list<Tp>> {};
+
+        template<typename ... Tp>
+        struct flattened<type_list<Tp...>> : public identity<concat_t<typename flattened<Tp>::type...>> {};
+    }
+
+    template<typename List> struct type_list_flatten;
+
+    template<typename ... Tp>
+    struct type_list_flatten<type_list<Tp...>> : public impl::flattened<type_list<Tp...>> {};
+
+    template<typename List>
+    using type_list_flatten_t [[maybe_unused]] = typename type_list_flatten<List>::type;
+
+    // Cartesian product, a type list of the type lists taking one element of each list, the last list varying the
+    // fastest. The lists are multiplied one after the other: each combination already built is extended by every
+    // element of the next list in one expansion and the results concatenated, so the depth depends on the number of
+    // lists and on the number of combinations divided by 16, never on one instantiation per combination.
+    namespace impl
+    {
+        template<typename Combination, typename ... Up>
+        struct extended_combinations;
+
+        template<typename ... Tp, typename ... Up>
+        struct extended_combinations<type_list<Tp...>, Up...> : public identity<type_list<type_list<Tp..., Up>...>> {};
+
+        template<typename Combinations, typename List>
+        struct multiply_combinations;
+
+        template<typename ... Combinations, typename ... Up>
+        struct multiply_combinations<type_list<Combinations...>, type_list<Up...>> :
+                public identity<concat_t<typename extended_combinations<Combinations, Up...>::type...>> {};
+
+        template<typename Combinations, typename ... Lists>
+        struct cartesian_product : public identity<Combinations> {};
+
+        template<typename Combinations, typename List, typename ... Lists>
+        struct cartesian_product<Combinations, List, Lists...> :
+                public cartesian_product<typename multiply_combinations<Combinations, List>::type, Lists...> {};
     }
 
+    template<typename ... Lists>
+    struct type_list_cartesian_product : public impl::cartesian_product<type_list<type_list<>>, Lists...> {};
+
+    template<typename ... Lists>
+    using type_list_cartesian_product_t [[maybe_unused]] = typename type_list_cartesian_product<Lists...>::type;
 }
 
 #endif //BAZAAR_TYPE_LIST_HPP
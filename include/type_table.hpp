@@ -0,0 +1,93 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef BAZAAR_TYPE_TABLE_HPP
+#define BAZAAR_TYPE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "bazaar_traits.hpp"
+#include "type_hash.hpp"
+#include "type_list.hpp"
+
+namespace bazaar::traits
+{
+    //-------------------------------------------------------------------------------------------
+    // Runtime metadata of types
+    //-------------------------------------------------------------------------------------------
+
+    // Type descriptor, what runtime code such as serializers and allocators needs to know about a type it only holds
+    // by index. It is an aggregate of scalars, so an array of descriptors is constant initialized.
+    struct type_descriptor {
+        std::size_t size;
+        std::size_t alignment;
+        std::uint64_t hash;
+        bool is_trivially_copyable;
+        bool is_trivially_destructible;
+        bool is_nothrow_move_constructible;
+        bool has_unique_object_representations;
+    };
+
+    template<typename Tp>
+    struct type_descriptor_of {
+        static_assert(is_object_v<Tp> && !is_unbounded_array_v<Tp>, "Template argument must be a complete object type");
+        static constexpr type_descriptor value{
+                sizeof(Tp),
+                alignof(Tp),
+                type_hash_v<Tp>,
+                is_trivially_copyable_v<Tp>,
+                is_trivially_destructible_v<Tp>,
+                is_nothrow_move_constructible_v<Tp>,
+                has_unique_object_representations_v<Tp>};
+    };
+
+    template<typename Tp>
+    [[maybe_unused]] inline constexpr auto type_descriptor_of_v{type_descriptor_of<Tp>::value};
+
+    // Type table, the descriptors of the elements of a type list in their order. The array is a static constexpr
+    // member, emitted once in a read only section, so a lookup by index is a single load instead of a virtual call.
+    // The array starts with an unused element which keeps it non empty for an empty list.
+    template<typename List> struct type_table;
+
+    template<typename ... Tp>
+    struct type_table<type_list<Tp...>> {
+    private:
+        static constexpr type_descriptor descriptors[sizeof ...(Tp) + 1]{{}, type_descriptor_of<Tp>::value...};
+    public:
+        static constexpr std::size_t size() noexcept {return sizeof ...(Tp);}
+        static constexpr const type_descriptor *begin() noexcept {return descriptors + 1;}
+        static constexpr const type_descriptor *end() noexcept {return begin() + size();}
+
+        // Descriptor at index, which must be lower than size().
+        static constexpr const type_descriptor &at(std::size_t index) noexcept {return begin()[index];}
+
+        // Index of Up in the list, size() when it is not part of it.
+        template<typename Up>
+        static constexpr std::size_t index_of() noexcept {return type_list_index_of_v<type_list<Tp...>, Up>;}
+
+        // Index of the first descriptor with the given hash, size() when there is none.
+        static constexpr std::size_t find(std::uint64_t hash) noexcept {
+            std::size_t index{0};
+            while (index < size() && at(index).hash != hash) ++index;
+            return index;
+        }
+    };
+}
+
+#endif //BAZAAR_TYPE_TABLE_HPP
@@ -955,6 +955,38 @@ namespace
                   sizeof(bzt::make_unsigned_t<const volatile wchar_t>) == 4);
 }
 
+[[maybe_unused]] void test_uint_least_for_value() {
+    static_assert(bzt::is_same_v<unsigned char, bzt::uint_least_for_value_t<0>>);
+    static_assert(bzt::is_same_v<unsigned char, bzt::uint_least_for_value_t<255>>);
+    static_assert(bzt::is_same_v<unsigned short, bzt::uint_least_for_value_t<256>>);
+    static_assert(bzt::is_same_v<unsigned short, bzt::uint_least_for_value_t<65535>>);
+    static_assert(bzt::is_same_v<unsigned int, bzt::uint_least_for_value_t<65536>>);
+    static_assert(bzt::is_same_v<unsigned int, bzt::uint_least_for_value_t<4294967295ull>>);
+    static_assert(bzt::is_same_v<std::conditional_t<sizeof(long) == 8, unsigned long, unsigned long long>,
+            bzt::uint_least_for_value_t<4294967296ull>>);
+    static_assert(sizeof(bzt::uint_least_for_value_t<~0ull>) == sizeof(unsigned long long));
+}
+
+[[maybe_unused]] void test_uint_fast_for_value() {
+    static_assert(bzt::is_same_v<unsigned int, bzt::uint_fast_for_value_t<0>>);
+    static_assert(bzt::is_same_v<unsigned int, bzt::uint_fast_for_value_t<65536>>);
+    static_assert(bzt::is_same_v<bzt::uint_least_for_value_t<4294967296ull>,
+            bzt::uint_fast_for_value_t<4294967296ull>>);
+}
+
+[[maybe_unused]] void test_int_least_for_range() {
+    static_assert(bzt::is_same_v<signed char, bzt::int_least_for_range_t<0, 0>>);
+    static_assert(bzt::is_same_v<signed char, bzt::int_least_for_range_t<-128, 127>>);
+    static_assert(bzt::is_same_v<signed short, bzt::int_least_for_range_t<-129, 0>>);
+    static_assert(bzt::is_same_v<signed short, bzt::int_least_for_range_t<0, 128>>);
+    static_assert(bzt::is_same_v<signed short, bzt::int_least_for_range_t<-32768, 32767>>);
+    static_assert(bzt::is_same_v<signed int, bzt::int_least_for_range_t<-32769, 32767>>);
+    static_assert(bzt::is_same_v<std::conditional_t<sizeof(long) == 8, signed long, signed long long>,
+            bzt::int_least_for_range_t<-2147483649ll, 0>>);
+    static_assert(sizeof(bzt::int_least_for_range_t<-9223372036854775807ll - 1, 9223372036854775807ll>) ==
+            sizeof(long long));
+}
+
 [[maybe_unused]] void test_is_constructible(){
     static_assert(bzt::is_constructible_v<Constructible, int>);
     static_assert(bzt::is_constructible_v<Constructible, float>);
@@ -75,4 +75,16 @@ struct test_enable_if_with_sfinae<condition,
     static_assert(bzt::is_same_v<bzt::conditional_t<true, std::conditional_t<false, long,short>, void>, short>);
 }
 
+[[maybe_unused]] void test_is_one_of(){
+    static_assert(!bzt::impl::is_one_of_v<int>);
+    static_assert(bzt::impl::is_one_of_v<int, int>);
+    static_assert(bzt::impl::is_one_of_v<int, char, long, int>);
+    static_assert(!bzt::impl::is_one_of_v<int, char, long, const int>);
+    static_assert(bzt::impl::is_one_of_v<void, void, int, void>);
+    static_assert(!bzt::impl::is_one_of_v<char, void, int, void>);
+    static_assert(bzt::impl::is_true_one_of_v<bzt::false_type, bzt::false_type, bzt::true_type>);
+    static_assert(!bzt::impl::is_true_one_of_v<bzt::false_type, bzt::false_type>);
+    static_assert(bzt::impl::is_false_one_of_v<bzt::true_type, bzt::false_type, bzt::false_type>);
+}
+
 int main() {return EXIT_SUCCESS;}
\ No newline at end of file
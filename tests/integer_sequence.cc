@@ -118,4 +118,136 @@ using unsignedChar255 = bzt::integer_sequence<unsigned char, 0, 1, 2, 3, 4, 5, 6
     static_assert(bzt::is_same_v<makeFor5, bzt::index_sequence<0,1,2,3,4>>);
 }
 
+// The portable generator, tested directly since the builtin is taken when the compiler has one
+template<std::size_t N>
+using generated = typename bzt::impl::make_index_sequence_impl<N>::template convert<bzt::integer_sequence, std::size_t>;
+
+[[maybe_unused]] void test_make_index_sequence_generator() {
+
+    static_assert(bzt::is_same_v<generated<0>, bzt::index_sequence<>>);
+    static_assert(bzt::is_same_v<generated<1>, bzt::index_sequence<0>>);
+    static_assert(bzt::is_same_v<generated<2>, bzt::index_sequence<0,1>>);
+    static_assert(bzt::is_same_v<generated<3>, bzt::index_sequence<0,1,2>>);
+    static_assert(bzt::is_same_v<generated<15>, bzt::index_sequence<0,1,2,3,4,5,6,7,8,9,10,11,12,13,14>>);
+    static_assert(bzt::is_same_v<generated<16>, bzt::index_sequence<0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15>>);
+    static_assert(bzt::is_same_v<generated<17>, bzt::index_sequence<0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16>>);
+    static_assert(bzt::is_same_v<generated<255>, bzt::make_index_sequence<255>>);
+    static_assert(bzt::is_same_v<generated<256>, bzt::make_index_sequence<256>>);
+    static_assert(bzt::is_same_v<generated<257>, bzt::make_index_sequence<257>>);
+}
+
+[[maybe_unused]] void test_make_integer_range() {
+
+    static_assert(bzt::is_same_v<bzt::make_index_range<0, 5>, bzt::make_index_sequence<5>>);
+    static_assert(bzt::is_same_v<bzt::make_index_range<3, 7>, bzt::index_sequence<3, 4, 5, 6>>);
+    static_assert(bzt::is_same_v<bzt::make_index_range<2, 11, 3>, bzt::index_sequence<2, 5, 8>>);
+    static_assert(bzt::is_same_v<bzt::make_index_range<2, 12, 3>, bzt::index_sequence<2, 5, 8, 11>>);
+    static_assert(bzt::is_same_v<bzt::make_index_range<4, 4>, bzt::index_sequence<>>);
+    static_assert(bzt::is_same_v<bzt::make_index_range<9, 4>, bzt::index_sequence<>>);
+
+    static_assert(bzt::is_same_v<bzt::make_integer_range<int, -3, 3, 2>, bzt::integer_sequence<int, -3, -1, 1>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<int, 5, 0, -1>, bzt::integer_sequence<int, 5, 4, 3, 2, 1>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<int, 5, -5, -4>, bzt::integer_sequence<int, 5, 1, -3>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<int, 0, 5, -1>, bzt::integer_sequence<int>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<short, -2, 1>, bzt::integer_sequence<short, -2, -1, 0>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<signed char, 127, -128, -127>,
+            bzt::integer_sequence<signed char, 127, 0, -127>>);
+    static_assert(bzt::is_same_v<bzt::make_integer_range<unsigned char, 250, 255, 2>,
+            bzt::integer_sequence<unsigned char, 250, 252, 254>>);
+    static_assert(bzt::make_integer_range<long long, -9223372036854775807 - 1, 9223372036854775807,
+            4611686018427387904>::size() == 4);
+    static_assert(bzt::make_index_range<0, 100000, 7>::size() == 14286);
+}
+
+using sizes = bzt::integer_sequence<std::size_t, sizeof(char), sizeof(int), sizeof(short), sizeof(double)>;
+using empty = bzt::integer_sequence<int>;
+
+[[maybe_unused]] void test_integer_sequence_algorithms() {
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_concat_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_concat_t<int1, empty, bzt::integer_sequence<int, 7, 8>>,
+            bzt::integer_sequence<int, 1, 7, 8>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_concat_t<size10, bzt::make_index_range<10, 20>>,
+            bzt::make_index_sequence<20>>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_reverse_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_reverse_t<char8>,
+            bzt::integer_sequence<char, 48, 69, 25, 11, 5, 7, 8, 9>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_reverse_t<bzt::make_integer_sequence<int, 6>>,
+            bzt::make_integer_range<int, 5, -1, -1>>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inclusive_scan_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inclusive_scan_t<unsignedInt4>,
+            bzt::integer_sequence<unsigned int, 0, 10, 15, 23>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inclusive_scan_t<ones30>, bzt::make_integer_range<int, 1, 31>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_exclusive_scan_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_exclusive_scan_t<sizes>,
+            bzt::index_sequence<0, sizeof(char), sizeof(char) + sizeof(int),
+                    sizeof(char) + sizeof(int) + sizeof(short)>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_exclusive_scan_t<short7>,
+            bzt::integer_sequence<short, 0, 1, 5, 12, 20, 29, 36>>);
+
+    static_assert(bzt::integer_sequence_sum_v<empty> == 0);
+    static_assert(bzt::integer_sequence_sum_v<int50> == 3 * 50 * 51 / 2);
+    static_assert(bzt::integer_sequence_sum_v<sizes> ==
+            sizeof(char) + sizeof(int) + sizeof(short) + sizeof(double));
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sum<short7>::value_type, short>);
+    static_assert(bzt::integer_sequence_product_v<empty> == 1);
+    static_assert(bzt::integer_sequence_product_v<bzt::integer_sequence<long, 1, 4, 7, 8, 9>> == 1 * 4 * 7 * 8 * 9);
+    static_assert(bzt::integer_sequence_product_v<size10> == 0);
+
+    static_assert(bzt::integer_sequence_at_v<int1, 0> == 1);
+    static_assert(bzt::integer_sequence_at_v<char8, 7> == 48);
+    static_assert(bzt::integer_sequence_at_v<unsignedCharRange, 255> == 255);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_at<char8, 0>::value_type, char>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_select_t<char8, bzt::index_sequence<>>,
+            bzt::integer_sequence<char>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_select_t<char8, bzt::index_sequence<7, 0, 0, 3>>,
+            bzt::integer_sequence<char, 48, 9, 9, 5>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_select_t<int50, bzt::make_index_range<0, 50, 10>>,
+            bzt::integer_sequence<int, 3, 33, 63, 93, 123>>);
+}
+
+using unsorted = bzt::integer_sequence<int, 4, -2, 7, 4, 0, -2, 9, 4>;
+
+[[maybe_unused]] void test_integer_sequence_sort() {
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<int1>, int1>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<char8>,
+            bzt::integer_sequence<char, 5, 7, 8, 9, 11, 25, 48, 69>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<unsorted>,
+            bzt::integer_sequence<int, -2, -2, 0, 4, 4, 4, 7, 9>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_sort_t<bzt::make_integer_range<int, 99, -1, -1>>,
+            bzt::make_integer_sequence<int, 100>>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_argsort_t<empty>, bzt::index_sequence<>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_argsort_t<char8>,
+            bzt::index_sequence<3, 2, 1, 0, 4, 5, 7, 6>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_argsort_t<unsorted>,
+            bzt::index_sequence<1, 5, 4, 0, 3, 7, 2, 6>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_select_t<unsorted, bzt::integer_sequence_argsort_t<unsorted>>,
+            bzt::integer_sequence_sort_t<unsorted>>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<bzt::index_sequence<>>,
+            bzt::index_sequence<>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<bzt::index_sequence<2, 0, 1>>,
+            bzt::index_sequence<1, 2, 0>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<bzt::integer_sequence<int, 3, 0, 2, 1>>,
+            bzt::integer_sequence<int, 1, 3, 2, 0>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<
+            bzt::integer_sequence_argsort_t<unsorted>>, bzt::index_sequence<3, 0, 6, 4, 2, 1, 7, 5>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_inverse_permutation_t<
+            bzt::integer_sequence_inverse_permutation_t<bzt::index_sequence<1, 5, 4, 0, 3, 7, 2, 6>>>,
+            bzt::index_sequence<1, 5, 4, 0, 3, 7, 2, 6>>);
+
+    static_assert(bzt::is_same_v<bzt::integer_sequence_unique_t<empty>, empty>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_unique_t<char8>, char8>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_unique_t<unsorted>,
+            bzt::integer_sequence<int, 4, -2, 7, 0, 9>>);
+    static_assert(bzt::is_same_v<bzt::integer_sequence_unique_t<bzt::integer_sequence<unsigned, 3, 3, 3>>,
+            bzt::integer_sequence<unsigned, 3>>);
+}
+
 int main() {return EXIT_SUCCESS;}
\ No newline at end of file
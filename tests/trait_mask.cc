@@ -0,0 +1,80 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cstdlib>
+#include <utility>
+#include "trait_mask.hpp"
+#include "classes.hpp"
+
+namespace bzt = bazaar::traits;
+
+struct Polymorphic { virtual ~Polymorphic() = default; };
+
+template<typename Tp>
+using properties = bzt::trait_mask<Tp,
+        bzt::is_class,
+        bzt::is_empty,
+        bzt::is_trivially_copyable,
+        bzt::is_polymorphic,
+        bzt::is_final,
+        bzt::is_enum>;
+
+[[maybe_unused]] void test_trait_mask(){
+    static_assert(bzt::trait_mask_v<int> == 0);
+    static_assert(bzt::trait_mask<int>::size() == 0);
+    static_assert(bzt::trait_mask<int>::none());
+    static_assert(bzt::trait_mask_v<int, bzt::is_integral> == 1);
+    static_assert(bzt::trait_mask_v<int, bzt::is_class, bzt::is_integral, bzt::is_signed> == 0b110);
+    static_assert(bzt::is_same_v<bzt::trait_mask<int, bzt::is_integral>::value_type, std::uint64_t>);
+
+    static_assert(properties<EmptyStructType>::value == 0b000111);
+    static_assert(properties<Polymorphic>::value == 0b001001);
+#ifndef BAZAAR_TRAITS_NO_COMPILER_SUPPORT
+    // The fallback of is_empty derives from the type, which a final class forbids.
+    static_assert(properties<finalClass>::value == 0b010111);
+#endif
+    static_assert(properties<EnumType>::value == 0b100100);
+    static_assert(properties<UnionType>::value == 0b000100);
+    static_assert(properties<int>::value == 0b000100);
+}
+
+[[maybe_unused]] void test_trait_mask_accessors(){
+    static_assert(properties<int>::size() == 6);
+    static_assert(properties<int>::index_of<bzt::is_class>() == 0);
+    static_assert(properties<int>::index_of<bzt::is_enum>() == 5);
+    static_assert(properties<int>::index_of<bzt::is_void>() == properties<int>::size());
+    static_assert(properties<int>::bit<bzt::is_polymorphic>() == 0b001000);
+
+    static_assert(properties<Polymorphic>::has<bzt::is_polymorphic>());
+    static_assert(!properties<Polymorphic>::has<bzt::is_empty>());
+    static_assert(properties<Polymorphic>::test(0));
+    static_assert(!properties<Polymorphic>::test(1));
+    static_assert(!properties<Polymorphic>::test(64));
+
+#ifndef BAZAAR_TRAITS_NO_COMPILER_SUPPORT
+    static_assert(properties<finalClass>::count() == 4);
+#endif
+    static_assert(properties<int>::count() == 1);
+    static_assert(properties<int>::any());
+    static_assert(!properties<int>::all());
+    static_assert(!properties<int>::none());
+    static_assert(bzt::trait_mask<int, bzt::is_integral, bzt::is_signed, bzt::is_arithmetic>::all());
+}
+
+int main() {return EXIT_SUCCESS;}
@@ -0,0 +1,67 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cstdlib>
+#include <utility>
+#include "helper_traits.hpp"
+#include "type_hash.hpp"
+#include "classes.hpp"
+
+namespace bzt = bazaar::traits;
+
+namespace named { template<typename Tp> struct Wrapper {}; }
+
+template<typename Tp>
+constexpr int dispatch() noexcept {
+    switch (bzt::type_hash_v<Tp>) {
+        case bzt::type_hash_v<int>: return 1;
+        case bzt::type_hash_v<EmptyStructType>: return 2;
+        case bzt::type_hash_v<named::Wrapper<int>>: return 3;
+        default: return 0;
+    }
+}
+
+[[maybe_unused]] void test_type_name(){
+    static_assert(bzt::type_name_v<int> == "int");
+    static_assert(bzt::type_name_v<EmptyStructType> == "EmptyStructType");
+    static_assert(bzt::type_name_v<Tp> == "Tp");
+    static_assert(bzt::type_name_v<EnumClassType> == "EnumClassType");
+    static_assert(bzt::type_name_v<named::Wrapper<Tp>> == "named::Wrapper<Tp>");
+    static_assert(bzt::type_name<int>{}() == "int");
+    static_assert(bzt::type_name_v<int> != bzt::type_name_v<const int>);
+    static_assert(bzt::type_name_v<int> != bzt::type_name_v<int &>);
+}
+
+[[maybe_unused]] void test_type_hash(){
+    static_assert(bzt::is_same_v<bzt::type_hash<int>::value_type, std::uint64_t>);
+    static_assert(bzt::type_hash_v<int> == bzt::type_hash_v<int>);
+    static_assert(bzt::type_hash_v<int> != bzt::type_hash_v<unsigned int>);
+    static_assert(bzt::type_hash_v<int> != bzt::type_hash_v<const int>);
+    static_assert(bzt::type_hash_v<int *> != bzt::type_hash_v<int &>);
+    static_assert(bzt::type_hash_v<EmptyStructType> != bzt::type_hash_v<EmptyClassType>);
+    static_assert(bzt::type_hash_v<named::Wrapper<int>> != bzt::type_hash_v<named::Wrapper<long>>);
+    // FNV-1a of "int"
+    static_assert(bzt::type_hash_v<int> == 0x2b9fff192bd4c83eull);
+    static_assert(dispatch<int>() == 1);
+    static_assert(dispatch<EmptyStructType>() == 2);
+    static_assert(dispatch<named::Wrapper<int>>() == 3);
+    static_assert(dispatch<long>() == 0);
+}
+
+int main() {return EXIT_SUCCESS;}
@@ -0,0 +1,375 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cstdlib>
+#include <utility>
+#include "bazaar_traits.hpp"
+#include "type_list.hpp"
+#include "classes.hpp"
+
+namespace bzt = bazaar::traits;
+
+using empty_list = bzt::type_list<>;
+using single_list = bzt::type_list<EmptyClassType>;
+using mixed_list = bzt::type_list<int, EnumType, const char*, UnionType, int, EmptyStructType&>;
+
+[[maybe_unused]] void test_type_list_size(){
+    static_assert(bzt::type_list_size_v<empty_list> == 0);
+    static_assert(bzt::type_list_size_v<single_list> == 1);
+    static_assert(bzt::type_list_size_v<mixed_list> == 6);
+    static_assert(mixed_list::size() == 6);
+    static_assert(bzt::is_same_v<mixed_list::type, mixed_list>);
+}
+
+[[maybe_unused]] void test_type_list_at(){
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<single_list, 0>, EmptyClassType>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 0>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 1>, EnumType>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 2>, const char*>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 3>, UnionType>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 4>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<mixed_list, 5>, EmptyStructType&>);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<mixed_list>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_back_t<mixed_list>, EmptyStructType&>);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<single_list>, EmptyClassType>);
+    static_assert(bzt::is_same_v<bzt::type_list_back_t<single_list>, EmptyClassType>);
+}
+
+[[maybe_unused]] void test_type_list_index_of(){
+    static_assert(bzt::type_list_index_of_v<empty_list, int> == 0);
+    static_assert(bzt::type_list_index_of_v<single_list, EmptyClassType> == 0);
+    static_assert(bzt::type_list_index_of_v<mixed_list, int> == 0);
+    static_assert(bzt::type_list_index_of_v<mixed_list, UnionType> == 3);
+    static_assert(bzt::type_list_index_of_v<mixed_list, EmptyStructType&> == 5);
+    static_assert(bzt::type_list_index_of_v<mixed_list, EmptyStructType> == 6);
+    static_assert(bzt::type_list_index_of_v<mixed_list, const int> == 6);
+}
+
+[[maybe_unused]] void test_type_list_contains(){
+    static_assert(!bzt::type_list_contains_v<empty_list, int>);
+    static_assert(bzt::type_list_contains_v<single_list, EmptyClassType>);
+    static_assert(bzt::type_list_contains_v<mixed_list, const char*>);
+    static_assert(!bzt::type_list_contains_v<mixed_list, char*>);
+    static_assert(!bzt::type_list_contains_v<mixed_list, EmptyStructType>);
+}
+
+[[maybe_unused]] void test_type_list_cons_conversions(){
+    static_assert(bzt::is_same_v<bzt::type_list_from_cons_t<bzt::signed_types_list>,
+            bzt::type_list<signed char, signed short, signed int, signed long, signed long long>>);
+    static_assert(bzt::is_same_v<bzt::type_list_from_cons_t<bzt::unsigned_types_list>,
+            bzt::type_list<unsigned char, unsigned short, unsigned int, unsigned long, unsigned long long>>);
+    static_assert(bzt::is_same_v<bzt::type_list_from_cons_t<bzt::impl::end_of_list>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_to_cons_t<bzt::type_list_from_cons_t<bzt::signed_types_list>>,
+            bzt::signed_types_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_to_cons_t<empty_list>, bzt::impl::end_of_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_to_cons_t<single_list>,
+            bzt::type_list_t<EmptyClassType, bzt::impl::end_of_list>>);
+}
+
+using empty_set = bzt::type_set<>;
+using integers_set = bzt::type_set<short, int, long>;
+using mixed_set = bzt::type_set<int, EnumType, UnionType, const char*>;
+
+[[maybe_unused]] void test_type_set_contains(){
+    static_assert(empty_set::size() == 0);
+    static_assert(integers_set::size() == 3);
+    static_assert(!bzt::type_set_contains_v<empty_set, int>);
+    static_assert(bzt::type_set_contains_v<integers_set, short>);
+    static_assert(bzt::type_set_contains_v<integers_set, long>);
+    static_assert(!bzt::type_set_contains_v<integers_set, const int>);
+    static_assert(!bzt::type_set_contains_v<integers_set, unsigned int>);
+    static_assert(bzt::type_set_contains_v<mixed_set, UnionType>);
+    static_assert(bzt::type_set_contains_v<mixed_set, const char*>);
+    static_assert(!bzt::type_set_contains_v<mixed_set, char*>);
+    static_assert(!bzt::type_set_contains_v<mixed_set, void>);
+}
+
+[[maybe_unused]] void test_type_set_insert(){
+    static_assert(bzt::is_same_v<bzt::type_set_insert_t<empty_set, int>, bzt::type_set<int>>);
+    static_assert(bzt::is_same_v<bzt::type_set_insert_t<integers_set, int>, integers_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_insert_t<integers_set, char>, bzt::type_set<short, int, long, char>>);
+}
+
+[[maybe_unused]] void test_type_set_union(){
+    static_assert(bzt::is_same_v<bzt::type_set_union_t<empty_set, empty_set>, empty_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_union_t<empty_set, integers_set>, integers_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_union_t<integers_set, empty_set>, integers_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_union_t<integers_set, integers_set>, integers_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_union_t<integers_set, mixed_set>,
+            bzt::type_set<short, int, long, EnumType, UnionType, const char*>>);
+}
+
+[[maybe_unused]] void test_type_set_intersection(){
+    static_assert(bzt::is_same_v<bzt::type_set_intersection_t<empty_set, integers_set>, empty_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_intersection_t<integers_set, empty_set>, empty_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_intersection_t<integers_set, integers_set>, integers_set>);
+    static_assert(bzt::is_same_v<bzt::type_set_intersection_t<integers_set, mixed_set>, bzt::type_set<int>>);
+    static_assert(bzt::is_same_v<bzt::type_set_intersection_t<mixed_set, bzt::type_set<const char*, EnumType>>,
+            bzt::type_set<EnumType, const char*>>);
+}
+
+using empty_map = bzt::type_map<>;
+using codecs_map = bzt::type_map<bzt::type_pair<int, EnumType>,
+        bzt::type_pair<EmptyStructType, UnionType>,
+        bzt::type_pair<const char*, void>,
+        bzt::type_pair<UnionType, int[2]>>;
+
+[[maybe_unused]] void test_type_map_at(){
+    static_assert(empty_map::size() == 0);
+    static_assert(codecs_map::size() == 4);
+    static_assert(bzt::is_same_v<bzt::type_map_at_t<codecs_map, int>, EnumType>);
+    static_assert(bzt::is_same_v<bzt::type_map_at_t<codecs_map, EmptyStructType>, UnionType>);
+    static_assert(bzt::is_same_v<bzt::type_map_at_t<codecs_map, const char*>, void>);
+    static_assert(bzt::is_same_v<bzt::type_map_at_t<codecs_map, UnionType>, int[2]>);
+}
+
+[[maybe_unused]] void test_type_map_contains(){
+    static_assert(!bzt::type_map_contains_v<empty_map, int>);
+    static_assert(bzt::type_map_contains_v<codecs_map, int>);
+    static_assert(bzt::type_map_contains_v<codecs_map, UnionType>);
+    static_assert(!bzt::type_map_contains_v<codecs_map, EnumType>);
+    static_assert(!bzt::type_map_contains_v<codecs_map, const int>);
+    static_assert(!bzt::type_map_contains_v<codecs_map, void>);
+}
+
+[[maybe_unused]] void test_type_map_insert_or_assign(){
+    static_assert(bzt::is_same_v<bzt::type_map_insert_or_assign_t<empty_map, int, long>,
+            bzt::type_map<bzt::type_pair<int, long>>>);
+    static_assert(bzt::is_same_v<bzt::type_map_insert_or_assign_t<codecs_map, const char*, char>,
+            bzt::type_map<bzt::type_pair<int, EnumType>,
+                    bzt::type_pair<EmptyStructType, UnionType>,
+                    bzt::type_pair<const char*, char>,
+                    bzt::type_pair<UnionType, int[2]>>>);
+    static_assert(bzt::is_same_v<bzt::type_map_insert_or_assign_t<codecs_map, void, void>,
+            bzt::type_map<bzt::type_pair<int, EnumType>,
+                    bzt::type_pair<EmptyStructType, UnionType>,
+                    bzt::type_pair<const char*, void>,
+                    bzt::type_pair<UnionType, int[2]>,
+                    bzt::type_pair<void, void>>>);
+}
+
+[[maybe_unused]] void test_type_map_keys_values(){
+    static_assert(bzt::is_same_v<bzt::type_map_keys_t<empty_map>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_map_values_t<empty_map>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_map_keys_t<codecs_map>,
+            bzt::type_list<int, EmptyStructType, const char*, UnionType>>);
+    static_assert(bzt::is_same_v<bzt::type_map_values_t<codecs_map>,
+            bzt::type_list<EnumType, UnionType, void, int[2]>>);
+}
+
+struct alignas(16) Aligned16 { char value[32]; };
+
+[[maybe_unused]] void test_type_list_sort_by_alignment(){
+    using empty = bzt::type_list_sort_by_alignment<empty_list>;
+    static_assert(bzt::is_same_v<empty::type, empty_list>);
+    static_assert(bzt::is_same_v<empty::permutation, bzt::integer_sequence<std::size_t>>);
+    static_assert(bzt::is_same_v<empty::inverse_permutation, bzt::integer_sequence<std::size_t>>);
+
+    using fields = bzt::type_list_sort_by_alignment<bzt::type_list<char, double, short, int, char, Aligned16, int[3]>>;
+    static_assert(bzt::is_same_v<fields::type, bzt::type_list<Aligned16, double, int[3], int, short, char, char>>);
+    static_assert(bzt::is_same_v<fields::permutation, bzt::integer_sequence<std::size_t, 5, 1, 6, 3, 2, 0, 4>>);
+    static_assert(bzt::is_same_v<fields::inverse_permutation,
+            bzt::integer_sequence<std::size_t, 5, 1, 4, 3, 6, 0, 2>>);
+
+    using sorted = bzt::type_list<double, int, short, char>;
+    static_assert(bzt::is_same_v<bzt::type_list_sort_by_alignment_t<sorted>, sorted>);
+    static_assert(bzt::is_same_v<bzt::type_list_sort_by_alignment<sorted>::permutation,
+            bzt::integer_sequence<std::size_t, 0, 1, 2, 3>>);
+}
+
+[[maybe_unused]] void test_concat(){
+    static_assert(bzt::is_same_v<bzt::impl::concat_t<>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::impl::concat_t<empty_list, empty_list>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::impl::concat_t<bzt::type_list<int>, empty_list, bzt::type_list<char, long>>,
+            bzt::type_list<int, char, long>>);
+    using one = bzt::type_list<int>;
+    using two = bzt::type_list<char, short>;
+    // More lists than a group.
+    static_assert(bzt::impl::concat_t<one, two, one, two, one, two, one, two, one, two, one, two, one, two, one, two,
+            one, two, one, two, one, two, one, two, one, two, one, two, one, two, one, two, one, two>::size() == 51);
+    static_assert(bzt::is_same_v<bzt::type_list_back_t<bzt::impl::concat_t<one, one, one, one, one, one, one, one, one,
+            one, one, one, one, one, one, one, one, two>>, short>);
+}
+
+[[maybe_unused]] void test_type_list_transform(){
+    static_assert(bzt::is_same_v<bzt::type_list_transform_t<empty_list, bzt::add_pointer>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_transform_t<mixed_list, bzt::add_pointer>,
+            bzt::type_list<int*, EnumType*, const char**, UnionType*, int*, EmptyStructType*>>);
+    static_assert(bzt::is_same_v<bzt::type_list_transform_t<bzt::type_list<const int&, int[2]>, bzt::decay>,
+            bzt::type_list<int, int*>>);
+}
+
+[[maybe_unused]] void test_type_list_filter(){
+    static_assert(bzt::is_same_v<bzt::type_list_filter_t<empty_list, bzt::is_integral>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_filter_t<mixed_list, bzt::is_integral>, bzt::type_list<int, int>>);
+    static_assert(bzt::is_same_v<bzt::type_list_filter_t<mixed_list, bzt::is_void>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_filter_t<mixed_list, bzt::is_object>,
+            bzt::type_list<int, EnumType, const char*, UnionType, int>>);
+}
+
+[[maybe_unused]] void test_type_list_remove_if(){
+    static_assert(bzt::is_same_v<bzt::type_list_remove_if_t<empty_list, bzt::is_integral>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_remove_if_t<mixed_list, bzt::is_integral>,
+            bzt::type_list<EnumType, const char*, UnionType, EmptyStructType&>>);
+    static_assert(bzt::is_same_v<bzt::type_list_remove_if_t<mixed_list, bzt::is_void>, mixed_list>);
+}
+
+[[maybe_unused]] void test_type_list_partition(){
+    using partition = bzt::type_list_partition_t<mixed_list, bzt::is_union>;
+    static_assert(bzt::is_same_v<partition::first_type, bzt::type_list<UnionType>>);
+    static_assert(bzt::is_same_v<partition::second_type,
+            bzt::type_list<int, EnumType, const char*, int, EmptyStructType&>>);
+    static_assert(bzt::is_same_v<bzt::type_list_partition_t<empty_list, bzt::is_union>,
+            bzt::type_pair<empty_list, empty_list>>);
+}
+
+[[maybe_unused]] void test_type_list_count_if(){
+    static_assert(bzt::type_list_count_if_v<empty_list, bzt::is_integral> == 0);
+    static_assert(bzt::type_list_count_if_v<mixed_list, bzt::is_integral> == 2);
+    static_assert(bzt::type_list_count_if_v<mixed_list, bzt::is_pointer> == 1);
+    static_assert(bzt::type_list_count_if_v<mixed_list, bzt::is_void> == 0);
+}
+
+[[maybe_unused]] void test_type_list_all_any_none_of(){
+    static_assert(bzt::type_list_all_of_v<empty_list, bzt::is_void>);
+    static_assert(!bzt::type_list_any_of_v<empty_list, bzt::is_void>);
+    static_assert(bzt::type_list_none_of_v<empty_list, bzt::is_void>);
+
+    static_assert(bzt::type_list_all_of_v<bzt::type_list<short, int, long>, bzt::is_integral>);
+    static_assert(!bzt::type_list_all_of_v<mixed_list, bzt::is_object>);
+    static_assert(bzt::type_list_any_of_v<mixed_list, bzt::is_reference>);
+    static_assert(!bzt::type_list_any_of_v<mixed_list, bzt::is_floating_point>);
+    static_assert(bzt::type_list_none_of_v<mixed_list, bzt::is_floating_point>);
+    static_assert(!bzt::type_list_none_of_v<mixed_list, bzt::is_enum>);
+}
+
+// Instantiating the predicate for Poison is an error, the elements after the first match must not be tested.
+struct Poison {};
+
+template<typename Tp>
+struct is_unsigned_unpoisoned : public bzt::is_unsigned<Tp> {
+    static_assert(!bzt::is_same_v<Tp, Poison>, "predicate evaluated after the first match");
+};
+
+using poisoned_list = bzt::type_list<int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int,
+        int, int, unsigned, Poison, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int,
+        int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, Poison>;
+
+[[maybe_unused]] void test_type_list_index_of_if(){
+    static_assert(bzt::type_list_index_of_if_v<empty_list, bzt::is_integral> == 0);
+    static_assert(bzt::type_list_index_of_if_v<mixed_list, bzt::is_integral> == 0);
+    static_assert(bzt::type_list_index_of_if_v<mixed_list, bzt::is_union> == 3);
+    static_assert(bzt::type_list_index_of_if_v<mixed_list, bzt::is_floating_point> == 6);
+    static_assert(bzt::type_list_index_of_if_v<poisoned_list, is_unsigned_unpoisoned> == 18);
+    static_assert(bzt::type_list_index_of_if_v<bzt::type_list<short, unsigned, Poison>, is_unsigned_unpoisoned> == 1);
+    static_assert(bzt::type_list_index_of_if_v<bzt::type_list_filter_t<poisoned_list, bzt::is_signed>,
+            bzt::is_unsigned> == 54);
+}
+
+template<typename Find, typename = void>
+struct test_find_if_with_sfinae : public std::false_type {};
+template<typename Find>
+struct test_find_if_with_sfinae<Find, std::void_t<typename Find::type>> : public std::true_type {};
+[[maybe_unused]] void test_type_list_find_if(){
+    static_assert(bzt::is_same_v<bzt::type_list_find_if_t<mixed_list, bzt::is_pointer>, const char*>);
+    static_assert(bzt::is_same_v<bzt::type_list_find_if_t<mixed_list, bzt::is_reference>, EmptyStructType&>);
+    static_assert(bzt::is_same_v<bzt::type_list_find_if_t<poisoned_list, is_unsigned_unpoisoned>, unsigned>);
+    static_assert(test_find_if_with_sfinae<bzt::type_list_find_if<mixed_list, bzt::is_pointer>>::value);
+    static_assert(!test_find_if_with_sfinae<bzt::type_list_find_if<mixed_list, bzt::is_floating_point>>::value);
+    static_assert(!test_find_if_with_sfinae<bzt::type_list_find_if<empty_list, bzt::is_void>>::value);
+}
+
+// Instantiating the transform for Poison is an error, only the accessed elements must be transformed.
+template<typename Tp>
+struct add_pointer_unpoisoned : public bzt::add_pointer<Tp> {
+    static_assert(!bzt::is_same_v<Tp, Poison>, "transform evaluated for an element not accessed");
+};
+
+[[maybe_unused]] void test_type_list_transform_view(){
+    using view = bzt::type_list_transform_view<mixed_list, bzt::add_pointer>;
+    static_assert(bzt::type_list_size_v<view> == 6);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<view, 2>, const char**>);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<view>, int*>);
+    static_assert(bzt::is_same_v<bzt::type_list_back_t<view>, EmptyStructType*>);
+    static_assert(bzt::type_list_size_v<bzt::type_list_transform_view<empty_list, bzt::add_pointer>> == 0);
+
+    using poisoned_view = bzt::type_list_transform_view<poisoned_list, add_pointer_unpoisoned>;
+    static_assert(bzt::type_list_size_v<poisoned_view> == 57);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<poisoned_view, 18>, unsigned*>);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<poisoned_view>, int*>);
+}
+
+[[maybe_unused]] void test_type_list_filter_view(){
+    using view = bzt::type_list_filter_view<mixed_list, bzt::is_integral>;
+    static_assert(bzt::type_list_size_v<view> == 2);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<view>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_back_t<view>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<bzt::type_list_filter_view<mixed_list, bzt::is_object>, 2>,
+            const char*>);
+    static_assert(bzt::type_list_size_v<bzt::type_list_filter_view<empty_list, bzt::is_void>> == 0);
+
+    using signed_view = bzt::type_list_filter_view<poisoned_list, bzt::is_signed>;
+    static_assert(bzt::type_list_size_v<signed_view> == 54);
+    static_assert(bzt::is_same_v<bzt::type_list_at_t<signed_view, 53>, int>);
+    static_assert(bzt::is_same_v<bzt::type_list_front_t<bzt::type_list_filter_view<poisoned_list,
+            is_unsigned_unpoisoned>>, unsigned>);
+}
+
+[[maybe_unused]] void test_type_list_unique(){
+    static_assert(bzt::is_same_v<bzt::type_list_unique_t<empty_list>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_unique_t<mixed_list>,
+            bzt::type_list<int, EnumType, const char*, UnionType, EmptyStructType&>>);
+    static_assert(bzt::is_same_v<bzt::type_list_unique_t<bzt::type_list<int, int, int>>, bzt::type_list<int>>);
+    static_assert(bzt::is_same_v<bzt::type_list_unique_t<bzt::type_list<char, int, const int, char, int&, int>>,
+            bzt::type_list<char, int, const int, int&>>);
+}
+
+[[maybe_unused]] void test_type_list_concat(){
+    static_assert(bzt::is_same_v<bzt::type_list_concat_t<>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_concat_t<mixed_list>, mixed_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_concat_t<bzt::type_list<int>, empty_list, bzt::type_list<char, int>>,
+            bzt::type_list<int, char, int>>);
+}
+
+[[maybe_unused]] void test_type_list_flatten(){
+    static_assert(bzt::is_same_v<bzt::type_list_flatten_t<empty_list>, empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_flatten_t<mixed_list>, mixed_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_flatten_t<bzt::type_list<empty_list, bzt::type_list<empty_list>>>,
+            empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_flatten_t<bzt::type_list<int, bzt::type_list<char,
+            bzt::type_list<long, bzt::type_list<short>>, float>, double>>,
+            bzt::type_list<int, char, long, short, float, double>>);
+    // Only type lists are flattened.
+    static_assert(bzt::is_same_v<bzt::type_list_flatten_t<bzt::type_list<bzt::type_set<int, char>>>,
+            bzt::type_list<bzt::type_set<int, char>>>);
+}
+
+[[maybe_unused]] void test_type_list_cartesian_product(){
+    static_assert(bzt::is_same_v<bzt::type_list_cartesian_product_t<>, bzt::type_list<empty_list>>);
+    static_assert(bzt::is_same_v<bzt::type_list_cartesian_product_t<bzt::type_list<int, char>, empty_list>,
+            empty_list>);
+    static_assert(bzt::is_same_v<bzt::type_list_cartesian_product_t<bzt::type_list<int, char>>,
+            bzt::type_list<bzt::type_list<int>, bzt::type_list<char>>>);
+    static_assert(bzt::is_same_v<bzt::type_list_cartesian_product_t<bzt::type_list<int, char>,
+            bzt::type_list<float>, bzt::type_list<long, short>>,
+            bzt::type_list<bzt::type_list<int, float, long>, bzt::type_list<int, float, short>,
+                    bzt::type_list<char, float, long>, bzt::type_list<char, float, short>>>);
+}
+
+int main() {return EXIT_SUCCESS;}
@@ -0,0 +1,37 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Must not compile: a map repeating a key is rejected by the lookups. Built by the type_map_repeated_key tests, with
+// TYPE_MAP_REPEATED_KEY_AT to check type_map_at and without it to check type_map_contains.
+
+#include <cstdlib>
+#include <utility>
+#include "type_list.hpp"
+
+namespace bzt = bazaar::traits;
+
+using repeated_key_map = bzt::type_map<bzt::type_pair<int, char>, bzt::type_pair<int, long>>;
+
+#ifdef TYPE_MAP_REPEATED_KEY_AT
+[[maybe_unused]] bzt::type_map_at_t<repeated_key_map, int> value{};
+#else
+static_assert(!bzt::type_map_contains_v<repeated_key_map, int>);
+#endif
+
+int main() {return EXIT_SUCCESS;}
@@ -0,0 +1,83 @@
+// Copyright (c) 2022 Papa Libasse Sow.
+// https://github.com/Nandite/bazaar_traits
+// Distributed under the MIT Software License (X11 license).
+//
+// SPDX-License-Identifier: MIT
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+// the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <cstdlib>
+#include <utility>
+#include "type_table.hpp"
+#include "classes.hpp"
+
+namespace bzt = bazaar::traits;
+
+struct alignas(16) Aligned { char bytes[32]; };
+struct Padded { char c; int i; };
+struct Owning {
+    Owning() = default;
+    Owning(Owning &&) noexcept(false) {}
+    ~Owning() {}
+};
+
+using types = bzt::type_list<int, Aligned, Padded, Owning, EmptyStructType>;
+using table = bzt::type_table<types>;
+
+constexpr std::size_t count_trivially_copyable() noexcept {
+    std::size_t count{0};
+    for (const auto &descriptor : table{}) count += descriptor.is_trivially_copyable;
+    return count;
+}
+
+[[maybe_unused]] void test_type_descriptor(){
+    constexpr auto descriptor{bzt::type_descriptor_of_v<Aligned>};
+    static_assert(descriptor.size == 32);
+    static_assert(descriptor.alignment == 16);
+    static_assert(descriptor.hash == bzt::type_hash_v<Aligned>);
+    static_assert(descriptor.is_trivially_copyable);
+    static_assert(descriptor.is_trivially_destructible);
+    static_assert(descriptor.is_nothrow_move_constructible);
+    static_assert(descriptor.has_unique_object_representations);
+
+    static_assert(!bzt::type_descriptor_of_v<Padded>.has_unique_object_representations);
+    static_assert(!bzt::type_descriptor_of_v<Owning>.is_trivially_copyable);
+    static_assert(!bzt::type_descriptor_of_v<Owning>.is_trivially_destructible);
+    static_assert(!bzt::type_descriptor_of_v<Owning>.is_nothrow_move_constructible);
+    static_assert(bzt::type_descriptor_of_v<int[4]>.size == 4 * sizeof(int));
+}
+
+[[maybe_unused]] void test_type_table(){
+    static_assert(table::size() == 5);
+    static_assert(table::end() - table::begin() == 5);
+    static_assert(table::at(0).size == sizeof(int));
+    static_assert(table::at(1).alignment == 16);
+    static_assert(table::at(3).hash == bzt::type_hash_v<Owning>);
+    static_assert(!table::at(3).is_trivially_copyable);
+    static_assert(table::at(4).size == 1);
+
+    static_assert(table::index_of<Padded>() == 2);
+    static_assert(table::index_of<long>() == table::size());
+    static_assert(table::find(bzt::type_hash_v<Owning>) == 3);
+    static_assert(table::find(bzt::type_hash_v<long>) == table::size());
+    static_assert(&table::at(table::index_of<Aligned>()) == table::begin() + 1);
+    static_assert(count_trivially_copyable() == 4);
+
+    using empty = bzt::type_table<bzt::type_list<>>;
+    static_assert(empty::size() == 0);
+    static_assert(empty::begin() == empty::end());
+    static_assert(empty::find(bzt::type_hash_v<int>) == 0);
+}
+
+int main() {return EXIT_SUCCESS;}